@@ -22,11 +22,14 @@
 #endif /* WIN32 */
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/algorithm/string/trim.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/nowide/args.hpp>
 #include <boost/nowide/cenv.hpp>
 #include <boost/nowide/iostream.hpp>
 #include <boost/nowide/integration/filesystem.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
 #include <boost/dll/runtime_symbol_info.hpp>
 
 #include "unix/fhs.hpp"  // Generated by CMake from ../platform/unix/fhs.hpp.in
@@ -299,7 +302,9 @@ int CLI::run(int argc, char **argv)
         }
     }
 
-    if (!start_gui) {
+    // In server mode, stdin is the job queue.
+    const bool start_server = std::find(m_actions.begin(), m_actions.end(), "server") != m_actions.end();
+    if (!start_gui && !start_server) {
         const auto* post_process = m_print_config.opt<ConfigOptionStrings>("post_process");
         if (post_process != nullptr && !post_process->empty()) {
             boost::nowide::cout << "\nA post-processing script has been detected in the config data:\n\n";
@@ -630,6 +635,7 @@ int CLI::run(int argc, char **argv)
                 if (printer_technology == ptFFF) {
                     for (auto* mo : model.objects)
                         fff_print.auto_assign_extruders(mo);
+                    fff_print.set_compress_finished_layers(m_config.opt_bool("compress_layers"));
                 }
                 print->apply(model, m_print_config);
                 std::pair<PrintBase::PrintValidationError, std::string> err = print->validate();
@@ -698,6 +704,9 @@ int CLI::run(int argc, char **argv)
                     << " (" << print.total_extruded_volume()/1000 << "cm3)" << std::endl;
 */
             }
+        } else if (opt_key == "server") {
+            if (! this->serve(printer_technology))
+                return 1;
         } else {
             boost::nowide::cerr << "error: option not supported yet: " << opt_key << std::endl;
             return 1;
@@ -926,6 +935,176 @@ bool CLI::export_models(IO::ExportFormat format)
     return true;
 }
 
+namespace {
+
+// Model read by the server, reused by the next jobs while the file isn't modified.
+struct ServerModel
+{
+    std::time_t         last_write_time;
+    Model               model;
+    // Configuration stored in the 3MF / AMF.
+    DynamicPrintConfig  config;
+};
+
+// Models read by the server, indexed by their path.
+class ServerModelCache
+{
+public:
+    const ServerModel& get(const std::string &path, ForwardCompatibilitySubstitutionRule config_substitution_rule)
+    {
+        if (! boost::filesystem::exists(path))
+            throw Slic3r::RuntimeError("No such file: " + path);
+        std::time_t last_write_time = boost::filesystem::last_write_time(path);
+        if (auto it = m_models.find(path); it != m_models.end() && it->second.last_write_time == last_write_time)
+            return it->second;
+        if (m_models.size() >= max_models)
+            m_models.clear();
+        ServerModel &cached = m_models[path];
+        cached.last_write_time = last_write_time;
+        cached.config.clear();
+        ConfigSubstitutionContext config_substitutions(config_substitution_rule);
+        cached.model = Model::read_from_file(path, &cached.config, &config_substitutions, Model::LoadAttribute::AddDefaultInstances);
+        if (cached.model.objects.empty()) {
+            m_models.erase(path);
+            throw Slic3r::RuntimeError("File is empty: " + path);
+        }
+        return cached;
+    }
+
+private:
+    static constexpr size_t max_models = 16;
+    std::map<std::string, ServerModel> m_models;
+};
+
+// Value of a job entry which is either a string or an array of strings.
+static std::vector<std::string> job_strings(const boost::property_tree::ptree &job, const char *key)
+{
+    std::vector<std::string> out;
+    if (boost::optional<const boost::property_tree::ptree&> entry = job.get_child_optional(key)) {
+        if (entry->empty())
+            out.emplace_back(entry->data());
+        else
+            for (const boost::property_tree::ptree::value_type &value : *entry)
+                out.emplace_back(value.second.data());
+    }
+    return out;
+}
+
+} // namespace
+
+bool CLI::serve(PrinterTechnology printer_technology)
+{
+    const ForwardCompatibilitySubstitutionRule config_substitution_rule = m_config.option<ConfigOptionEnum<ForwardCompatibilitySubstitutionRule>>("config_compatibility", true)->value;
+    // Kept between the jobs: Print::apply() only invalidates the steps affected by the differences with the previous job,
+    // and the models are read again only if their file has been modified.
+    Print            fff_print;
+    SLAPrint         sla_print;
+    ServerModelCache models;
+    fff_print.set_status_silent();
+    sla_print.set_status_silent();
+    fff_print.set_compress_finished_layers(m_config.opt_bool("compress_layers"));
+
+    // Slice one job, return the path of the exported file.
+    auto process_job = [&](const boost::property_tree::ptree &job) -> std::string {
+        // Configuration, by increasing priority: the configuration of the models, the command line, the loaded files, the job values.
+        DynamicPrintConfig config = m_print_config;
+        Model              model;
+        for (const std::string &file : job_strings(job, "input")) {
+            const ServerModel &cached = models.get(file, config_substitution_rule);
+            config.apply(cached.config, true);
+            for (const ModelObject *object : cached.model.objects)
+                model.add_object(*object);
+        }
+        if (model.objects.empty())
+            throw Slic3r::RuntimeError("No input model");
+        config.apply(m_extra_config, true);
+        for (const std::string &file : job_strings(job, "load")) {
+            DynamicPrintConfig loaded;
+            loaded.load(file, config_substitution_rule);
+            loaded.normalize_fdm();
+            config.apply(loaded);
+        }
+        if (boost::optional<const boost::property_tree::ptree&> values = job.get_child_optional("config")) {
+            ConfigSubstitutionContext config_substitutions(config_substitution_rule);
+            for (const boost::property_tree::ptree::value_type &value : *values)
+                config.set_deserialize(value.first, value.second.data(), config_substitutions);
+        }
+        config.normalize_fdm();
+        const PrinterTechnology job_technology = get_printer_technology(config) == ptUnknown ? printer_technology : get_printer_technology(config);
+        if (std::string validity = config.validate(); ! validity.empty())
+            throw Slic3r::RuntimeError("The composite configation is not valid: " + validity);
+
+        if (m_config.opt_bool("ensure_on_bed"))
+            for (ModelObject *object : model.objects)
+                object->ensure_on_bed();
+        if (! m_config.opt_bool("dont_arrange")) {
+            arr2::ArrangeSettings arrange_cfg;
+            arrange_cfg.set_distance_from_objects(min_object_distance(static_cast<const ConfigBase*>(&config)));
+            arrange_objects(model, arr2::to_arrange_bed(get_bed_shape(config)), arrange_cfg);
+        }
+        if (job_technology == ptFFF)
+            for (ModelObject *object : model.objects)
+                fff_print.auto_assign_extruders(object);
+
+        PrintBase *print = (job_technology == ptFFF) ? static_cast<PrintBase*>(&fff_print) : static_cast<PrintBase*>(&sla_print);
+        print->apply(model, config);
+        if (std::pair<PrintBase::PrintValidationError, std::string> err = print->validate(); err.first != PrintBase::PrintValidationError::pveNone)
+            throw Slic3r::RuntimeError(err.second);
+        if (print->empty())
+            throw Slic3r::RuntimeError("Nothing to print. Either the print is empty or no object is fully inside the print volume.");
+        print->process();
+
+        std::string outfile = job.get<std::string>("output", m_config.opt_string("output"));
+        std::string outfile_final;
+        if (job_technology == ptFFF) {
+            outfile       = fff_print.export_gcode(outfile, nullptr, nullptr);
+            outfile_final = fff_print.print_statistics().finalize_output_path(outfile);
+        } else {
+            outfile       = sla_print.output_filepath(outfile);
+            outfile_final = sla_print.print_statistics().finalize_output_path(outfile);
+            sla_print.export_print(outfile_final);
+        }
+        if (outfile != outfile_final) {
+            if (Slic3r::rename_file(outfile, outfile_final))
+                throw Slic3r::RuntimeError("Renaming file " + outfile + " to " + outfile_final + " failed");
+            outfile = outfile_final;
+        }
+        if (job_technology == ptFFF)
+            run_post_process_scripts(outfile, fff_print.full_print_config());
+        return outfile;
+    };
+
+    std::string line;
+    while (std::getline(boost::nowide::cin, line)) {
+        boost::algorithm::trim(line);
+        if (line.empty())
+            continue;
+        boost::property_tree::ptree reply;
+        bool                        quit = false;
+        try {
+            boost::property_tree::ptree job;
+            std::istringstream          iss(line);
+            boost::property_tree::read_json(iss, job);
+            if (boost::optional<std::string> id = job.get_optional<std::string>("id"))
+                reply.put("id", *id);
+            if (job.get<std::string>("command", std::string()) == "quit")
+                quit = true;
+            else
+                reply.put("output", process_job(job));
+            reply.put("status", "ok");
+        } catch (const std::exception &ex) {
+            reply.put("status", "error");
+            reply.put("error", ex.what());
+        }
+        // write_json() ends the line.
+        boost::property_tree::write_json(boost::nowide::cout, reply, false);
+        boost::nowide::cout.flush();
+        if (quit)
+            break;
+    }
+    return true;
+}
+
 std::string CLI::output_filepath(const Model &model, IO::ExportFormat format) const
 {
     std::string ext;
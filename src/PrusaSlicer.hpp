@@ -40,6 +40,9 @@ private:
     /// Exports loaded models to a file of the specified format, according to the options affecting output filename.
     bool export_models(IO::ExportFormat format);
     
+    /// Slices the jobs read from stdin (JSON lines) until the end of the input or a "quit" command, keeping the prints warm between the jobs.
+    bool serve(PrinterTechnology printer_technology);
+
     bool has_print_action() const { return m_config.opt_bool("export_gcode") || m_config.opt_bool("export_sla"); }
     
     std::string output_filepath(const Model &model, IO::ExportFormat format) const;
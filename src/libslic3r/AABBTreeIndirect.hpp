@@ -11,6 +11,8 @@
 #define slic3r_AABBTreeIndirect_hpp_
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <limits>
 #include <type_traits>
 #include <vector>
@@ -792,6 +794,184 @@ inline bool intersect_ray_all_hits(
 	return ! hits.empty();
 }
 
+// Up to N rays to be traced through the AABB tree together by intersect_ray_packet_first_hit().
+// Packets pay off for coherent rays, for example rays shot from a single point into neighbor directions:
+// such rays visit mostly the same tree nodes, which are then fetched and tested once for the whole packet.
+template<typename AVectorType, size_t N = 8>
+struct RayPacket
+{
+    using VectorType = AVectorType;
+    using Scalar     = typename VectorType::Scalar;
+    static constexpr size_t Size = N;
+    static_assert(N > 0 && N <= 32, "Masks of the rays of a packet are stored in uint32_t");
+
+    std::array<VectorType, N>             origin;
+    std::array<VectorType, N>             dir;
+    // Origins and inverse directions as a structure of arrays, so that the ray-box tests of all rays vectorize.
+    std::array<std::array<Scalar, N>, 3>  origin_soa {};
+    std::array<std::array<Scalar, N>, 3>  invdir_soa {};
+    size_t                                count = 0;
+
+    void push_back(const VectorType &o, const VectorType &d) {
+        assert(! this->full());
+        origin[count] = o;
+        dir[count]    = d;
+        for (int i = 0; i < 3; ++ i) {
+            origin_soa[i][count] = o(i);
+            invdir_soa[i][count] = Scalar(1) / d(i);
+        }
+        ++ count;
+    }
+    void     clear()       { count = 0; }
+    size_t   size()  const { return count; }
+    bool     empty() const { return count == 0; }
+    bool     full()  const { return count == N; }
+    // Bit mask of the rays stored in the packet.
+    uint32_t mask()  const { return count == 32 ? ~uint32_t(0) : (uint32_t(1) << count) - 1; }
+};
+
+namespace detail {
+	// Branchless slab test of a box against all rays of a packet, so that the compiler vectorizes it.
+	// Returns bit mask of the rays entering the box at a parameter lower than their t_max,
+	// the entry parameters are returned in t_entry.
+	template<typename Packet, typename BoxScalar>
+	inline uint32_t ray_packet_box_intersect(
+		const Packet 											&packet,
+		const Eigen::AlignedBox<BoxScalar, 3> 					&box,
+		const std::array<typename Packet::Scalar, Packet::Size> &t_max,
+		std::array<typename Packet::Scalar, Packet::Size> 		&t_entry)
+	{
+		using Scalar = typename Packet::Scalar;
+		const Scalar bmin[3] = { Scalar(box.min().x()), Scalar(box.min().y()), Scalar(box.min().z()) };
+		const Scalar bmax[3] = { Scalar(box.max().x()), Scalar(box.max().y()), Scalar(box.max().z()) };
+		std::array<int32_t, Packet::Size> hit;
+		for (size_t i = 0; i < Packet::Size; ++ i) {
+			const Scalar tx0 = (bmin[0] - packet.origin_soa[0][i]) * packet.invdir_soa[0][i];
+			const Scalar tx1 = (bmax[0] - packet.origin_soa[0][i]) * packet.invdir_soa[0][i];
+			const Scalar ty0 = (bmin[1] - packet.origin_soa[1][i]) * packet.invdir_soa[1][i];
+			const Scalar ty1 = (bmax[1] - packet.origin_soa[1][i]) * packet.invdir_soa[1][i];
+			const Scalar tz0 = (bmin[2] - packet.origin_soa[2][i]) * packet.invdir_soa[2][i];
+			const Scalar tz1 = (bmax[2] - packet.origin_soa[2][i]) * packet.invdir_soa[2][i];
+			const Scalar tmin = std::max(std::max(std::min(tx0, tx1), std::min(ty0, ty1)), std::min(tz0, tz1));
+			const Scalar tmax = std::min(std::min(std::max(tx0, tx1), std::max(ty0, ty1)), std::max(tz0, tz1));
+			// Same conditions as ray_box_intersect_invdir(): the slabs overlap, the overlap starts before t_max
+			// and ends after zero.
+			hit[i]     = int32_t(tmin <= tmax) & int32_t(tmin < t_max[i]) & int32_t(tmax > Scalar(0));
+			t_entry[i] = tmin;
+		}
+		uint32_t mask = 0;
+		for (size_t i = 0; i < Packet::Size; ++ i)
+			mask |= uint32_t(hit[i]) << i;
+		return mask;
+	}
+} // namespace detail
+
+// Find first intersections of a packet of rays with indexed triangle set.
+// Returns the same first hits as intersect_ray_first_hit() called for each ray of the packet. If a ray hits
+// two triangles at exactly the same parameter (a shared edge), either of them may be returned.
+// Returns bit mask of the rays of the packet, which hit the mesh. hits[i] is valid for the rays with their bit set.
+template<typename VertexType, typename IndexedFaceType, typename TreeType, typename VectorType, size_t N>
+inline uint32_t intersect_ray_packet_first_hit(
+	// Indexed triangle set - 3D vertices.
+	const std::vector<VertexType> 		&vertices,
+	// Indexed triangle set - triangular faces, references to vertices.
+	const std::vector<IndexedFaceType> 	&faces,
+	// AABBTreeIndirect::Tree over vertices & faces, bounding boxes built with the accuracy of vertices.
+	const TreeType 						&tree,
+	// Rays to trace.
+	const RayPacket<VectorType, N> 		&packet,
+	// First intersections of the rays with the indexed triangle set.
+	std::array<igl::Hit, N> 			&hits,
+	// Epsilon for the ray-triangle intersection, it should be proportional to an average triangle edge length.
+	const double 						 eps = 0.000001)
+{
+    using Scalar = typename VectorType::Scalar;
+    if (tree.empty() || packet.empty())
+    	return 0;
+
+    std::array<Scalar, N> t_max;
+    t_max.fill(std::numeric_limits<Scalar>::infinity());
+    uint32_t hit_mask = 0;
+
+    // Node to visit, the rays entering its bounding box and their entry parameters. The nearer child is visited first,
+    // so that the rays find their first hits early and the farther nodes are culled by the shortened rays.
+    // The depth of the balanced tree is limited by the number of bits of size_t, at most one node per level is waiting.
+    struct StackItem {
+    	size_t 					node_idx;
+    	uint32_t 				mask;
+    	std::array<Scalar, N> 	t_entry;
+    };
+    std::array<StackItem, 8 * sizeof(size_t) + 1> stack;
+    size_t stack_size = 1;
+    stack.front().node_idx = 0;
+    stack.front().mask     = packet.mask() & detail::ray_packet_box_intersect(packet, tree.node(0).bbox, t_max, stack.front().t_entry);
+    while (stack_size > 0) {
+    	const StackItem &item     = stack[-- stack_size];
+    	size_t           node_idx = item.node_idx;
+    	uint32_t         mask     = item.mask;
+    	// Cull the rays, which found a hit closer than their entry to this node.
+    	for (size_t i = 0; i < N; ++ i)
+    		if (! (item.t_entry[i] < t_max[i]))
+    			mask &= ~(uint32_t(1) << i);
+    	if (mask == 0)
+    		continue;
+    	const auto &node = tree.node(node_idx);
+    	assert(node.is_valid());
+    	if ((mask & (mask - 1)) == 0) {
+    		// A single ray left, the packet has no benefit anymore. Finish the subtree with the single ray traversal.
+    		size_t i = 0;
+    		while (! (mask & (uint32_t(1) << i)))
+    			++ i;
+			auto ray_intersector = detail::RayIntersector<VertexType, IndexedFaceType, TreeType, VectorType> {
+				vertices, faces, tree,
+		        packet.origin[i], packet.dir[i], VectorType(packet.dir[i].cwiseInverse()),
+		        eps
+			};
+			igl::Hit hit;
+			if (detail::intersect_ray_recursive_first_hit(ray_intersector, node_idx, t_max[i], hit) && hit.t < t_max[i]) {
+				hits[i]   = hit;
+				t_max[i]  = Scalar(hit.t);
+		    	hit_mask |= uint32_t(1) << i;
+			}
+    	} else if (node.is_leaf()) {
+            auto face = faces[node.idx];
+            for (size_t i = 0; i < N; ++ i)
+            	if (mask & (uint32_t(1) << i)) {
+				    double t, u, v;
+				    if (detail::intersect_triangle(
+				    		packet.origin[i], packet.dir[i],
+				    		vertices[face(0)], vertices[face(1)], vertices[face(2)],
+		                    t, u, v, eps)
+				    	&& t > 0. && Scalar(float(t)) < t_max[i]) {
+				    	hits[i]   = igl::Hit { int(node.idx), -1, float(u), float(v), float(t) };
+				    	t_max[i]  = Scalar(hits[i].t);
+				    	hit_mask |= uint32_t(1) << i;
+				    }
+            	}
+    	} else {
+    		assert(stack_size + 2 <= stack.size());
+    		StackItem &left  = stack[stack_size];
+    		StackItem &right = stack[stack_size + 1];
+    		left.node_idx  = TreeType::left_child_idx(node_idx);
+    		right.node_idx = TreeType::right_child_idx(node_idx);
+    		left.mask  = mask & detail::ray_packet_box_intersect(packet, tree.node(left.node_idx).bbox,  t_max, left.t_entry);
+    		right.mask = mask & detail::ray_packet_box_intersect(packet, tree.node(right.node_idx).bbox, t_max, right.t_entry);
+    		// Majority of the rays entering both children decides, which one is nearer.
+    		int right_nearer = 0;
+    		for (size_t i = 0; i < N; ++ i)
+    			if (left.mask & right.mask & (uint32_t(1) << i))
+    				right_nearer += right.t_entry[i] < left.t_entry[i] ? 1 : -1;
+    		if (right_nearer <= 0)
+    			// The item on top of the stack is visited first, left child by default as intersect_ray_first_hit() does.
+    			std::swap(left, right);
+    		stack_size += (left.mask != 0) + (right.mask != 0);
+    		if (left.mask == 0)
+    			left = right;
+    	}
+    }
+    return hit_mask;
+}
+
 // Finding a closest triangle, its closest point and squared distance to the closest point
 // on a 3D indexed triangle set using a pre-built AABBTreeIndirect::Tree.
 // Closest point to triangle test will be performed with the accuracy of VectorType::Scalar
@@ -15,6 +15,9 @@
 #include "SVG.hpp"
 #include "Utils.hpp"
 
+#include <optional>
+
+#include <boost/functional/hash.hpp>
 #include <boost/log/trivial.hpp>
 
 //#define ARACHNE_STITCH_PATCH_DEBUG
@@ -25,7 +28,8 @@ namespace Slic3r::Arachne
 WallToolPaths::WallToolPaths(const Polygons& outline, const coord_t bead_spacing_0, const coord_t bead_width_0,
                              const coord_t bead_spacing_x, const coord_t bead_width_x,
                              const size_t inset_count, const coord_t wall_0_inset, const coordf_t layer_height,
-                             const PrintRegionConfig &print_region_config, const PrintConfig &print_config)
+                             const PrintRegionConfig &print_region_config, const PrintConfig &print_config,
+                             WallToolPathsCache *cache)
     : outline(outline)
     , perimeter_width_0(bead_width_0)
     , perimeter_width_x(bead_width_x)
@@ -42,6 +46,7 @@ WallToolPaths::WallToolPaths(const Polygons& outline, const coord_t bead_spacing
     , wall_transition_length(scaled<coord_t>(print_region_config.wall_transition_length.value))
     , toolpaths_generated(false)
     , print_region_config(print_region_config)
+    , cache(cache)
 {
     assert(!print_config.nozzle_diameter.empty());
     this->min_nozzle_diameter = float(*std::min_element(print_config.nozzle_diameter.get_values().begin(), print_config.nozzle_diameter.get_values().end()));
@@ -453,11 +458,95 @@ void removeColinearEdges(Polygons &thiss, const double max_deviation_angle = 0.0
     }
 }
 
+bool WallToolPathsCache::Key::operator==(const Key &rhs) const
+{
+    return bead_spacing_0 == rhs.bead_spacing_0 && bead_width_0 == rhs.bead_width_0 && bead_spacing_x == rhs.bead_spacing_x &&
+           bead_width_x == rhs.bead_width_x && inset_count == rhs.inset_count && wall_0_inset == rhs.wall_0_inset &&
+           min_feature_size == rhs.min_feature_size && min_bead_width == rhs.min_bead_width &&
+           wall_transition_filter_deviation == rhs.wall_transition_filter_deviation && wall_transition_length == rhs.wall_transition_length &&
+           wall_transition_angle == rhs.wall_transition_angle && wall_distribution_count == rhs.wall_distribution_count &&
+           outline == rhs.outline;
+}
+
+size_t WallToolPathsCache::Key::hash() const
+{
+    size_t seed = 0;
+    boost::hash_combine(seed, bead_spacing_0);
+    boost::hash_combine(seed, bead_width_0);
+    boost::hash_combine(seed, bead_spacing_x);
+    boost::hash_combine(seed, bead_width_x);
+    boost::hash_combine(seed, inset_count);
+    boost::hash_combine(seed, wall_0_inset);
+    boost::hash_combine(seed, min_feature_size);
+    boost::hash_combine(seed, min_bead_width);
+    boost::hash_combine(seed, wall_transition_filter_deviation);
+    boost::hash_combine(seed, wall_transition_length);
+    boost::hash_combine(seed, wall_transition_angle);
+    boost::hash_combine(seed, wall_distribution_count);
+    for (const Polygon &polygon : outline) {
+        boost::hash_combine(seed, polygon.size());
+        for (const Point &pt : polygon.points) {
+            boost::hash_combine(seed, pt.x());
+            boost::hash_combine(seed, pt.y());
+        }
+    }
+    return seed;
+}
+
+std::shared_ptr<const WallToolPathsCache::Result> WallToolPathsCache::find(const Key &key, size_t hash) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto range = entries.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++ it)
+        if (it->second->first == key)
+            return it->second->second;
+    return nullptr;
+}
+
+void WallToolPathsCache::insert(Key &&key, size_t hash, Result &&result)
+{
+    auto entry = std::make_shared<Entry>(std::move(key), std::make_shared<const Result>(std::move(result)));
+    std::lock_guard<std::mutex> lock(mutex);
+    while (! fifo.empty() && fifo.size() >= max_entries) {
+        auto range = entries.equal_range(fifo.front().first);
+        for (auto it = range.first; it != range.second; ++ it)
+            if (it->second == fifo.front().second) {
+                entries.erase(it);
+                break;
+            }
+        fifo.pop_front();
+    }
+    entries.emplace(hash, entry);
+    fifo.emplace_back(hash, std::move(entry));
+}
+
+void WallToolPathsCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    fifo.clear();
+}
+
 const std::vector<VariableWidthLines> &WallToolPaths::generate()
 {
     if (this->inset_count < 1)
         return toolpaths;
 
+    std::optional<WallToolPathsCache::Key> cache_key;
+    size_t                                 cache_hash = 0;
+    if (this->cache != nullptr) {
+        cache_key = WallToolPathsCache::Key{ outline, bead_spacing_0, perimeter_width_0, bead_spacing_x, perimeter_width_x, inset_count, wall_0_inset,
+                                             min_feature_size, min_bead_width, wall_transition_filter_deviation, wall_transition_length,
+                                             this->print_region_config.wall_transition_angle.value, this->print_region_config.wall_distribution_count.value };
+        cache_hash = cache_key->hash();
+        if (std::shared_ptr<const WallToolPathsCache::Result> cached = this->cache->find(*cache_key, cache_hash); cached) {
+            toolpaths           = cached->toolpaths;
+            inner_contour       = cached->inner_contour;
+            toolpaths_generated = true;
+            return toolpaths;
+        }
+    }
+
     const coord_t smallest_segment = Slic3r::Arachne::meshfix_maximum_resolution;
     const coord_t allowed_distance = Slic3r::Arachne::meshfix_maximum_deviation;
     const coord_t epsilon_offset = (allowed_distance / 2) - 1;
@@ -536,6 +625,8 @@ const std::vector<VariableWidthLines> &WallToolPaths::generate()
                               return l.front().inset_idx < r.front().inset_idx;
                           }) && "WallToolPaths should be sorted from the outer 0th to inner_walls");
     toolpaths_generated = true;
+    if (cache_key)
+        this->cache->insert(std::move(*cache_key), cache_hash, WallToolPathsCache::Result{ toolpaths, inner_contour });
     return toolpaths;
 }
 
@@ -4,7 +4,10 @@
 #ifndef CURAENGINE_WALLTOOLPATHS_H
 #define CURAENGINE_WALLTOOLPATHS_H
 
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include <ankerl/unordered_dense.h>
 
@@ -21,6 +24,55 @@ constexpr coord_t meshfix_maximum_resolution               = scaled<coord_t>(0.5
 constexpr coord_t meshfix_maximum_deviation                = scaled<coord_t>(0.025);
 constexpr coord_t meshfix_maximum_extrusion_area_deviation = scaled<coord_t>(2.);
 
+/*!
+ * Toolpaths generated for an outline, shared by the layers of an object that have the same outline and
+ * the same settings (prismatic parts), so that the skeletal trapezoidation isn't built again for each of them.
+ * Thread safe, it only keeps the last \p max_entries results.
+ */
+class WallToolPathsCache
+{
+public:
+    struct Key
+    {
+        Polygons outline;
+        coord_t  bead_spacing_0;
+        coord_t  bead_width_0;
+        coord_t  bead_spacing_x;
+        coord_t  bead_width_x;
+        size_t   inset_count;
+        coord_t  wall_0_inset;
+        coord_t  min_feature_size;
+        coord_t  min_bead_width;
+        coord_t  wall_transition_filter_deviation;
+        coord_t  wall_transition_length;
+        double   wall_transition_angle;
+        int      wall_distribution_count;
+
+        bool   operator==(const Key &rhs) const;
+        size_t hash() const;
+    };
+    struct Result
+    {
+        std::vector<VariableWidthLines> toolpaths;
+        Polygons                        inner_contour;
+    };
+
+    explicit WallToolPathsCache(size_t max_entries = 64) : max_entries(max_entries) {}
+
+    // Returns nullptr if these toolpaths weren't generated yet.
+    std::shared_ptr<const Result> find(const Key &key, size_t hash) const;
+    void                          insert(Key &&key, size_t hash, Result &&result);
+    void                          clear();
+
+private:
+    using Entry = std::pair<Key, std::shared_ptr<const Result>>;
+    mutable std::mutex                                        mutex;
+    std::unordered_multimap<size_t, std::shared_ptr<Entry>>   entries;
+    // Insertion order, the oldest entries are evicted first.
+    std::deque<std::pair<size_t, std::shared_ptr<Entry>>>     fifo;
+    size_t                                                    max_entries;
+};
+
 class WallToolPaths
 {
 public:
@@ -31,13 +83,15 @@ public:
      * \param bead_width_x The bead width of the inner walls used in the generation of the toolpaths
      * \param inset_count The maximum number of parallel extrusion lines that make up the wall
      * \param wall_0_inset How far to inset the outer wall, to make it adhere better to other walls.
+     * \param cache If not null, the toolpaths are taken from it when this outline was already processed with the same settings.
      */
     WallToolPaths(const Polygons& outline,
         coord_t bead_spacing_0,
         coord_t bead_width_0,
         coord_t bead_spacing_x,
         coord_t bead_width_x,
-        size_t inset_count, coord_t wall_0_inset, coordf_t layer_height, const PrintRegionConfig &print_region_config, const PrintConfig &print_config);
+        size_t inset_count, coord_t wall_0_inset, coordf_t layer_height, const PrintRegionConfig &print_region_config, const PrintConfig &print_config,
+        WallToolPathsCache *cache = nullptr);
 
     /*!
      * Generates the Toolpaths
@@ -131,6 +185,7 @@ private:
     std::vector<VariableWidthLines> toolpaths; //<! The generated toolpaths
     Polygons inner_contour;  //<! The inner contour of the generated toolpaths
     const PrintRegionConfig &print_region_config;
+    WallToolPathsCache *cache; //<! Toolpaths already generated for other layers, may be null
 };
 
 } // namespace Slic3r::Arachne
@@ -243,26 +243,50 @@ bool pack(Strategy &strategy,
     bool cancelled = strategy.stop_condition();
     const auto & rotations = allowed_rotations(item);
 
-    // Check all rotations but only if item is not already packed
-    for (auto rot_it = rotations.begin();
-         !cancelled && !packed && rot_it != rotations.end(); ++rot_it) {
-
-        double rot = *rot_it;
-
-        set_rotation(item, orig_rot + rot);
-        set_translation(item, orig_tr);
-
-        auto nfp = calculate_nfp(item, packing_context, bed,
-                                 strategy.stop_condition);
-        double score = NaNd;
-        if (!nfp.empty()) {
-            score = pick_best_spot_on_nfp(item, nfp, bed, strategy);
-
-            cancelled = strategy.stop_condition();
-            if (score > final_score) {
-                final_score = score;
-                final_rot   = rot;
-                final_tr    = get_translation(item);
+    // Check all rotations but only if item is not already packed. Every
+    // rotation is evaluated on its own copy of the item, so that they can be
+    // processed in parallel.
+    if (!cancelled && !packed) {
+        struct RotationResult
+        {
+            double  score = NaNd;
+            Vec2crd translation{0, 0};
+        };
+        std::vector<RotationResult> results(rotations.size());
+
+        // The fixed items are read concurrently: their lazily computed
+        // outlines have to be up to date beforehand.
+        for (const auto &fixed : all_items_range(packing_context))
+            fixed_outline(fixed);
+
+        execution::for_each(
+            strategy.ep, size_t(0), results.size(),
+            [&](size_t rot_idx) {
+                if (strategy.stop_condition())
+                    return;
+
+                ArrItem itm = item;
+                set_rotation(itm, orig_rot + rotations[rot_idx]);
+                set_translation(itm, orig_tr);
+
+                auto nfp = calculate_nfp(itm, packing_context, bed,
+                                         strategy.stop_condition);
+                if (!nfp.empty()) {
+                    results[rot_idx].score = pick_best_spot_on_nfp(itm, nfp,
+                                                                   bed,
+                                                                   strategy);
+                    results[rot_idx].translation = get_translation(itm);
+                }
+            });
+
+        cancelled = strategy.stop_condition();
+
+        // Same choice as a sequential evaluation: the first best rotation wins
+        for (size_t rot_idx = 0; rot_idx < results.size(); ++rot_idx) {
+            if (results[rot_idx].score > final_score) {
+                final_score = results[rot_idx].score;
+                final_rot   = rotations[rot_idx];
+                final_tr    = results[rot_idx].translation;
             }
         }
     }
@@ -15,6 +15,45 @@
 
 namespace Slic3r { namespace arr2 {
 
+size_t translation_invariant_hash(const Polygons &polys)
+{
+    size_t seed = polys.size();
+    if (polys.empty() || polys.front().empty())
+        return seed;
+
+    const Point origin = polys.front().points.front();
+    for (const Polygon &poly : polys) {
+        boost::hash_combine(seed, poly.size());
+        for (const Point &p : poly.points) {
+            boost::hash_combine(seed, p.x() - origin.x());
+            boost::hash_combine(seed, p.y() - origin.y());
+        }
+    }
+
+    return seed;
+}
+
+bool translation_invariant_equal(const Polygons &a, const Polygons &b)
+{
+    if (a.size() != b.size())
+        return false;
+    if (a.empty())
+        return true;
+    if (a.front().empty() || b.front().empty())
+        return a == b;
+
+    const Point shift = b.front().points.front() - a.front().points.front();
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].size() != b[i].size())
+            return false;
+        for (size_t j = 0; j < a[i].size(); ++j)
+            if (a[i].points[j] + shift != b[i].points[j])
+                return false;
+    }
+
+    return true;
+}
+
 const Polygons &DecomposedShape::transformed_outline() const
 {
     constexpr auto sc = scaled<double>(1.) * scaled<double>(1.);
@@ -6,7 +6,9 @@
 #define ARRANGEITEM_HPP
 
 #include <optional>
+#include <unordered_map>
 #include <boost/variant.hpp>
+#include <boost/container_hash/hash.hpp>
 
 #include "libslic3r/ExPolygon.hpp"
 #include "libslic3r/BoundingBox.hpp"
@@ -35,6 +37,13 @@ inline bool check_polygons_are_convex(const Polygons &pp) {
     });
 }
 
+// Hash of a set of polygons which is invariant to their translation: two sets
+// of polygons differing only by a translation have the same hash.
+size_t translation_invariant_hash(const Polygons &polys);
+
+// True if the two sets of polygons only differ by a translation.
+bool translation_invariant_equal(const Polygons &a, const Polygons &b);
+
 // A class that stores a set of polygons that are garanteed to be all convex.
 // They collectively represent a decomposition of a more complex shape into
 // its convex part. Note that this class only stores the result of the decomp,
@@ -47,6 +56,7 @@ inline bool check_polygons_are_convex(const Polygons &pp) {
 class DecomposedShape
 {
     Polygons m_shape;
+    size_t   m_shape_hash = 0; // translation_invariant_hash(m_shape)
 
     Vec2crd m_translation{0, 0}; // The translation of the poly
     double  m_rotation{0.0};     // The rotation of the poly in radians
@@ -72,6 +82,7 @@ public:
     explicit DecomposedShape(Polygon sh)
     {
         m_shape.emplace_back(std::move(sh));
+        m_shape_hash = translation_invariant_hash(m_shape);
         assert(check_polygons_are_convex(m_shape));
     }
 
@@ -81,11 +92,16 @@ public:
 
     explicit DecomposedShape(Polygons sh) : m_shape{std::move(sh)}
     {
+        m_shape_hash = translation_invariant_hash(m_shape);
         assert(check_polygons_are_convex(m_shape));
     }
 
     const Polygons &contours() const { return m_shape; }
 
+    // Two shapes with the same hash and the same rotation have the same
+    // transformed outline, up to a translation.
+    size_t shape_hash() const { return m_shape_hash; }
+
     const Vec2crd &translation() const { return m_translation; }
     double         rotation() const { return m_rotation; }
 
@@ -281,6 +297,57 @@ template<> struct WritableDataStoreTraits_<ArrangeItem>
     }
 };
 
+// Local cache of the nfps between the convex parts of the fixed items and the
+// convex parts of the item to pack, see calculate_nfp_unnormalized().
+class NFPCache
+{
+public:
+    // The untransformed contours of the fixed shape are compared on a hash
+    // hit, so a hash collision can't return the nfp of another shape. They
+    // must outlive the cache.
+    struct Key
+    {
+        const Polygons *fixed_shape;
+        size_t fixed_shape_hash;
+        double fixed_rotation;
+        size_t fixed_part;
+        size_t movable_part;
+
+        bool operator==(const Key &o) const
+        {
+            return fixed_shape_hash == o.fixed_shape_hash &&
+                   fixed_rotation == o.fixed_rotation &&
+                   fixed_part == o.fixed_part && movable_part == o.movable_part &&
+                   (fixed_shape == o.fixed_shape ||
+                    translation_invariant_equal(*fixed_shape, *o.fixed_shape));
+        }
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key &k) const
+        {
+            size_t seed = k.fixed_shape_hash;
+            boost::hash_combine(seed, k.fixed_rotation);
+            boost::hash_combine(seed, k.fixed_part);
+            boost::hash_combine(seed, k.movable_part);
+            return seed;
+        }
+    };
+
+    using Map = std::unordered_map<Key, Polygon, KeyHash>;
+
+    Map::iterator end() { return m_map.end(); }
+    Map::iterator find(const Key &k) { return m_map.find(k); }
+    std::pair<Map::iterator, bool> emplace(const Key &k, Polygon &&nfp)
+    {
+        return m_map.emplace(k, std::move(nfp));
+    }
+
+private:
+    Map m_map;
+};
+
 template<class FixedIt, class StopCond = DefaultStopCondition>
 static Polygons calculate_nfp_unnormalized(const ArrangeItem    &item,
                                            const Range<FixedIt> &fixed_items,
@@ -300,27 +367,37 @@ static Polygons calculate_nfp_unnormalized(const ArrangeItem    &item,
     Vec2crd ref_whole = item.envelope().reference_vertex();
     Polygon subnfp;
 
+    // The nfp of two convex parts doesn't depend on their position, only on
+    // their shape and rotation. The fixed items are often copies of the same
+    // object (fill bed, multiply selection), so each unique fixed part is only
+    // computed once. The cached nfps are stored with their reference vertex
+    // at the origin.
+    NFPCache nfp_cache;
+
     for (const ArrangeItem &fixed : fixed_items) {
         // fixed_polys should already be a set of strictly convex polygons,
         // as ArrangeItem stores convex-decomposed polygons
         const Polygons & fixed_polys = fixed.shape().transformed_outline();
 
-        for (const Polygon &fixed_poly : fixed_polys) {
+        for (size_t fi = 0; fi < fixed_polys.size(); ++fi) {
+            const Polygon &fixed_poly = fixed_polys[fi];
             Point max_fixed = Slic3r::reference_vertex(fixed_poly);
             for (size_t mi = 0; mi < item_outlines.size(); ++mi) {
-                const Polygon &movable = item_outlines[mi];
-                const Vec2crd &mref = item.envelope().reference_vertex(mi);
-                subnfp = nfp_convex_convex_legacy(fixed_poly, movable);
-
+                NFPCache::Key key{&fixed.shape().contours(),
+                                  fixed.shape().shape_hash(),
+                                  fixed.shape().rotation(), fi, mi};
+                auto cached = nfp_cache.find(key);
+                if (cached == nfp_cache.end()) {
+                    subnfp = nfp_convex_convex_legacy(fixed_poly, item_outlines[mi]);
+                    subnfp.translate(-Slic3r::reference_vertex(subnfp));
+                    cached = nfp_cache.emplace(key, std::move(subnfp)).first;
+                }
+                subnfp = cached->second;
+
+                // Place the nfp so that the reference vertex of the movable
+                // part touches the reference vertex of the fixed part.
                 Vec2crd min_movable = item.envelope().min_vertex(mi);
-
-                Vec2crd dtouch = max_fixed - min_movable;
-                Vec2crd top_other = mref + dtouch;
-                Vec2crd max_nfp = Slic3r::reference_vertex(subnfp);
-                auto dnfp = top_other - max_nfp;
-
-                auto d = ref_whole - mref + dnfp;
-                subnfp.translate(d);
+                subnfp.translate(ref_whole + max_fixed - min_movable);
                 nfps.emplace_back(subnfp);
             }
 
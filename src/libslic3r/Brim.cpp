@@ -14,6 +14,7 @@
 #include "Print.hpp"
 #include "PrintConfig.hpp"
 #include "ShortestPath.hpp"
+#include "Thread.hpp"
 #include "libslic3r.h"
 
 #include <algorithm>
@@ -1016,60 +1017,68 @@ void make_brim(const Print& print, const Flow& flow, const PrintObjectPtrs& obje
     const coord_t scaled_spacing = flow.scaled_spacing();
     const PrintObjectConfig& brim_config = objects.front()->config();
     coord_t brim_offset = scale_t(brim_config.brim_separation.value);
-    ExPolygons    islands;
-    for (PrintObject* object : objects) {
-        ExPolygons object_islands;
-        for (const ExPolygon &expoly : object->layers().front()->lslices()) {
-            if (brim_config.brim_inside_holes && brim_config.brim_width_interior == 0) {
-                if (brim_offset == 0) {
-                    object_islands.push_back(expoly);
-                } else {
-                    for (ExPolygon &grown_expoly : offset_ex(expoly, brim_offset)) {
-                        object_islands.push_back(std::move(grown_expoly));
+    //get brim resolution (lower resolution if no arc fitting)
+    coordf_t scaled_resolution_brim = (print.config().arc_fitting.value != ArcFittingType::Disabled)? scale_d(print.config().resolution) : scale_d(print.config().resolution_internal) / 10;
+    scaled_resolution_brim = std::max(scaled_resolution_brim, coordf_t(SCALED_EPSILON * 10));
+    // grow & simplify the islands of each object (only once per object, not per instance), in parallel.
+    std::vector<ExPolygons> objects_islands(objects.size());
+    Slic3r::parallel_for(size_t(0), objects.size(),
+        [&objects, &objects_islands, &brim_config, &flow, brim_offset, scaled_resolution_brim](const size_t obj_idx) {
+            const PrintObject *object = objects[obj_idx];
+            ExPolygons object_islands;
+            for (const ExPolygon &expoly : object->layers().front()->lslices()) {
+                if (brim_config.brim_inside_holes && brim_config.brim_width_interior == 0) {
+                    if (brim_offset == 0) {
+                        object_islands.push_back(expoly);
+                    } else {
+                        for (ExPolygon &grown_expoly : offset_ex(expoly, brim_offset)) {
+                            object_islands.push_back(std::move(grown_expoly));
+                        }
                     }
-                }
-            } else {
-                if (brim_offset == 0) {
-                    object_islands.push_back(to_expolygon(expoly.contour));
                 } else {
-                    for (ExPolygon &grown_expoly : offset_ex(to_expolygon(expoly.contour), brim_offset)) {
-                        object_islands.push_back(std::move(grown_expoly));
+                    if (brim_offset == 0) {
+                        object_islands.push_back(to_expolygon(expoly.contour));
+                    } else {
+                        for (ExPolygon &grown_expoly : offset_ex(to_expolygon(expoly.contour), brim_offset)) {
+                            object_islands.push_back(std::move(grown_expoly));
+                        }
                     }
                 }
             }
-        }
-        if (!object->support_layers().empty()) {
-            ExPolygons polys = union_ex(object->support_layers().front()->support_fills.polygons_covered_by_spacing(flow.spacing_ratio(), float(SCALED_EPSILON)));
-            for (ExPolygon& poly : polys) {
-                if (brim_offset == 0) {
-                    object_islands.push_back(std::move(poly));
-                } else {
-                    append(object_islands, offset_ex(ExPolygons{ poly }, brim_offset));
+            if (!object->support_layers().empty()) {
+                ExPolygons polys = union_ex(object->support_layers().front()->support_fills.polygons_covered_by_spacing(flow.spacing_ratio(), float(SCALED_EPSILON)));
+                for (ExPolygon& poly : polys) {
+                    if (brim_offset == 0) {
+                        object_islands.push_back(std::move(poly));
+                    } else {
+                        append(object_islands, offset_ex(ExPolygons{ poly }, brim_offset));
+                    }
                 }
             }
-        }
-        islands.reserve(islands.size() + object_islands.size() * object->instances().size());
-        for (const PrintInstance& pt : object->instances()) {
-            for (ExPolygon& poly : object_islands) {
-                islands.push_back(poly);
-                islands.back().translate(pt.shift.x(), pt.shift.y());
+            // simplify (a translation doesn't change the result, so it's done before the instance copy)
+            ExPolygons &simple_islands = objects_islands[obj_idx];
+            for (ExPolygon &expoly : object_islands) {
+                for (ExPolygon &simple_expoly : expoly.simplify(scaled_resolution_brim)) {
+                    simple_expoly.assert_valid();
+                    simple_islands.emplace_back(std::move(simple_expoly));
+                }
             }
-        }
-    }
+        });
 
     print.throw_if_canceled();
 
-    //simplify & merge
-    //get brim resolution (lower resolution if no arc fitting)
-    coordf_t scaled_resolution_brim = (print.config().arc_fitting.value != ArcFittingType::Disabled)? scale_d(print.config().resolution) : scale_d(print.config().resolution_internal) / 10;
-    scaled_resolution_brim = std::max(scaled_resolution_brim, coordf_t(SCALED_EPSILON * 10));
+    //merge
     ExPolygons unbrimmable_areas;
-    for (ExPolygon &expoly : islands) {
-        for (ExPolygon &simple_expoly : expoly.simplify(scaled_resolution_brim)) {
-            simple_expoly.assert_valid();
-            unbrimmable_areas.emplace_back(std::move(simple_expoly));
+    for (size_t obj_idx = 0; obj_idx < objects.size(); ++obj_idx) {
+        unbrimmable_areas.reserve(unbrimmable_areas.size() + objects_islands[obj_idx].size() * objects[obj_idx]->instances().size());
+        for (const PrintInstance &pt : objects[obj_idx]->instances()) {
+            for (const ExPolygon &poly : objects_islands[obj_idx]) {
+                unbrimmable_areas.push_back(poly);
+                unbrimmable_areas.back().translate(pt.shift.x(), pt.shift.y());
+            }
         }
     }
+    ExPolygons    islands;
     for (ExPolygon &expoly : unbrimmable_areas) expoly.assert_valid();
     islands = union_safety_offset_ex(unbrimmable_areas);
     // union_safety_offset_ex can shorten segments below epsilon. So we need to re-simplify a bit.
@@ -1122,6 +1131,11 @@ void make_brim(const Print& print, const Flow& flow, const PrintObjectPtrs& obje
         }
     }
     islands = bigger_islands;
+    // bounding boxes of the unbrimmable polygons, to only clip a hole against the islands near it.
+    std::vector<BoundingBox> unbrimmable_bboxes;
+    unbrimmable_bboxes.reserve(unbrimmable_polygons.size());
+    for (const Polygon &poly : unbrimmable_polygons)
+        unbrimmable_bboxes.push_back(poly.bounding_box());
     ExPolygons last_islands;
     for (size_t i = 0; i < num_loops; ++i) {
         loops.emplace_back();
@@ -1129,35 +1143,52 @@ void make_brim(const Print& print, const Flow& flow, const PrintObjectPtrs& obje
         // only grow the contour, not holes
         bigger_islands.clear();
         if (i > 0) {
-            for (ExPolygon &expoly : last_islands) {
-                expoly.assert_valid();
-                for (ExPolygon &big_contour : ensure_valid(scaled_resolution_brim, offset_ex(expoly, double(scaled_spacing), jtSquare))) {
-                    big_contour.assert_valid();
-                    bigger_islands.push_back(big_contour);
-                    Polygons simplifiesd_big_contour = big_contour.contour.simplify(scaled_resolution_brim);
-                    if (simplifiesd_big_contour.size() == 1) {
-                        bigger_islands.back().contour = simplifiesd_big_contour.front();
+            // each island is grown independently (they are merged just after), so do it in parallel.
+            std::vector<ExPolygons> grown_islands(last_islands.size());
+            Slic3r::parallel_for(size_t(0), last_islands.size(),
+                [&last_islands, &grown_islands, scaled_spacing, scaled_resolution_brim](const size_t island_idx) {
+                    const ExPolygon &expoly = last_islands[island_idx];
+                    expoly.assert_valid();
+                    for (ExPolygon &big_contour : ensure_valid(scaled_resolution_brim, offset_ex(expoly, double(scaled_spacing), jtSquare))) {
+                        big_contour.assert_valid();
+                        grown_islands[island_idx].push_back(big_contour);
+                        Polygons simplifiesd_big_contour = big_contour.contour.simplify(scaled_resolution_brim);
+                        if (simplifiesd_big_contour.size() == 1) {
+                            grown_islands[island_idx].back().contour = simplifiesd_big_contour.front();
+                        }
                     }
-                }
-            }
+                });
+            for (ExPolygons &grown : grown_islands)
+                append(bigger_islands, std::move(grown));
         } else {
             bigger_islands = islands;
         }
         last_islands = union_ex(bigger_islands);
         ensure_valid(last_islands, scaled_resolution_brim);
-        for (ExPolygon &expoly : last_islands) {
-            expoly.assert_valid();
-            loops.back().emplace_back(expoly.contour);
-            // also add hole, in case of it's merged with a contour. see supermerill/SuperSlicer/issues/3050
-            for (Polygon &hole : expoly.holes) {
-                hole.assert_valid();
-                // but remove the points that are inside the holes of islands
-                for (ExPolygon &pl : diff_ex(Polygons{hole}, unbrimmable_polygons)) {
-                    pl.assert_valid();
-                    loops[i].emplace_back(pl.contour);
+        std::vector<std::vector<BrimLoop>> island_loops(last_islands.size());
+        Slic3r::parallel_for(size_t(0), last_islands.size(),
+            [&last_islands, &island_loops, &unbrimmable_polygons, &unbrimmable_bboxes](const size_t island_idx) {
+                const ExPolygon &expoly = last_islands[island_idx];
+                expoly.assert_valid();
+                island_loops[island_idx].emplace_back(expoly.contour);
+                // also add hole, in case of it's merged with a contour. see supermerill/SuperSlicer/issues/3050
+                for (const Polygon &hole : expoly.holes) {
+                    hole.assert_valid();
+                    // but remove the points that are inside the holes of islands
+                    // (only the islands that can intersect this hole are useful for the diff)
+                    const BoundingBox hole_bbox = hole.bounding_box();
+                    Polygons near_unbrimmable;
+                    for (size_t poly_idx = 0; poly_idx < unbrimmable_polygons.size(); ++poly_idx)
+                        if (unbrimmable_bboxes[poly_idx].overlap(hole_bbox))
+                            near_unbrimmable.push_back(unbrimmable_polygons[poly_idx]);
+                    for (ExPolygon &pl : diff_ex(Polygons{hole}, near_unbrimmable)) {
+                        pl.assert_valid();
+                        island_loops[island_idx].emplace_back(pl.contour);
+                    }
                 }
-            }
-        }
+            });
+        for (std::vector<BrimLoop> &island_loop : island_loops)
+            append(loops[i], std::move(island_loop));
     }
 
     std::reverse(loops.begin(), loops.end());
@@ -1230,11 +1261,11 @@ void make_brim_ears(const Print& print, const Flow& flow, const PrintObjectPtrs&
         }
         islands.reserve(islands.size() + object_islands.size() * object->instances().size());
         coord_t ear_detection_length = std::max(scale_t(object->config().brim_ears_detection_length.value), SCALED_EPSILON);
-        // duplicate & translate for each instance
-        for (const PrintInstance& copy_pt : object->instances()) {
-            for (const ExPolygon& poly : object_islands) {
-                islands.push_back(poly);
-                islands.back().translate(copy_pt.shift.x(), copy_pt.shift.y());
+        // the ears only depend on the object islands, compute them once and translate them for each instance.
+        std::vector<Points> islands_ears(object_islands.size());
+        Slic3r::parallel_for(size_t(0), object_islands.size(),
+            [&object_islands, &islands_ears, &brim_config, ear_detection_length](const size_t island_idx) {
+                const ExPolygon &poly = object_islands[island_idx];
                 Polygon decimated_polygon;
                 // brim_ears_detection_length codepath
                 if (ear_detection_length > 0) {
@@ -1249,8 +1280,14 @@ void make_brim_ears(const Print& print, const Flow& flow, const PrintObjectPtrs&
                         decimated_polygon.points = MultiPoint::douglas_peucker(poly.contour.points, SCALED_EPSILON);
                     }
                 }
-                Points pts = decimated_polygon.convex_points(0, brim_config.brim_ears_max_angle.value * PI / 180.0);
-                for (const Point& p : pts) {
+                islands_ears[island_idx] = decimated_polygon.convex_points(0, brim_config.brim_ears_max_angle.value * PI / 180.0);
+            });
+        // duplicate & translate for each instance
+        for (const PrintInstance& copy_pt : object->instances()) {
+            for (size_t island_idx = 0; island_idx < object_islands.size(); ++island_idx) {
+                islands.push_back(object_islands[island_idx]);
+                islands.back().translate(copy_pt.shift.x(), copy_pt.shift.y());
+                for (const Point& p : islands_ears[island_idx]) {
                     pt_ears.push_back(p);
                     pt_ears.back() += (copy_pt.shift);
                 }
@@ -1483,20 +1520,28 @@ void make_brim_interior(const Print& print, const Flow& flow, const PrintObjectP
     for (size_t i = 0; i < num_loops; ++i) {
         print.throw_if_canceled();
         loops.emplace_back();
+        // each hole shrinks independently from the others
+        std::vector<Polygons> holes_offseted(islands_to_loops.size());
+        std::vector<Polygons> holes_loops(islands_to_loops.size());
+        Slic3r::parallel_for(size_t(0), islands_to_loops.size(),
+            [&islands_to_loops, &holes_offseted, &holes_loops, &flow, scaled_resolution_brim](const size_t hole_idx) {
+                Polygons &temp = holes_offseted[hole_idx];
+                temp = offset(islands_to_loops[hole_idx], double(-flow.scaled_spacing()), jtSquare);
+                for (Polygon& poly : temp) {
+                    poly.points.push_back(poly.points.front());
+                    Points p = MultiPoint::douglas_peucker(poly.points, scaled_resolution_brim);
+                    p.pop_back();
+                    poly.points = std::move(p);
+                }
+                holes_loops[hole_idx] = offset(temp, 0.5f * double(flow.scaled_spacing()));
+            });
         Polygons islands_to_loops_offseted;
-        for (Polygon& poly : islands_to_loops) {
-            Polygons temp = offset(poly, double(-flow.scaled_spacing()), jtSquare);
-            for (Polygon& poly : temp) {
-                poly.points.push_back(poly.points.front());
-                Points p = MultiPoint::douglas_peucker(poly.points, scaled_resolution_brim);
-                p.pop_back();
-                poly.points = std::move(p);
-            }
-            for (Polygon& poly : offset(temp, 0.5f * double(flow.scaled_spacing())))
+        for (size_t hole_idx = 0; hole_idx < islands_to_loops.size(); ++hole_idx) {
+            for (Polygon& poly : holes_loops[hole_idx])
                 loops[i].emplace_back(poly);
-            islands_to_loops_offseted.insert(islands_to_loops_offseted.end(), temp.begin(), temp.end());
+            append(islands_to_loops_offseted, std::move(holes_offseted[hole_idx]));
         }
-        islands_to_loops = islands_to_loops_offseted;
+        islands_to_loops = std::move(islands_to_loops_offseted);
     }
     //loops = union_pt_chained_outside_in(loops, false);
     std::reverse(loops.begin(), loops.end());
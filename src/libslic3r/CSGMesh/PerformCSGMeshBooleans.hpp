@@ -69,6 +69,60 @@ inline void perform_csg(CSGType op, CGALMeshPtr &dst, CGALMeshPtr &src)
     }
 }
 
+// Union of two meshes into dst. Meshes with disjoint bounding boxes are only merged, without the CGAL boolean.
+inline void union_pair(CGALMeshPtr &dst, CGALMeshPtr &src)
+{
+    if (!dst) {
+        dst = std::move(src);
+        return;
+    }
+    if (!src)
+        return;
+
+    if (MeshBoolean::cgal::bounding_box(*dst).intersects(MeshBoolean::cgal::bounding_box(*src)))
+        MeshBoolean::cgal::plus(*dst, *src);
+    else
+        MeshBoolean::cgal::merge(*dst, *src);
+}
+
+// Union of all the meshes, by a pairwise reduction. The pairs of each level are independent and processed in parallel.
+template<class Ex>
+CGALMeshPtr union_cgalptrs(Ex policy, std::vector<CGALMeshPtr> &meshes)
+{
+    if (meshes.empty())
+        return nullptr;
+
+    while (meshes.size() > 1) {
+        execution::for_each(policy, size_t(0), meshes.size() / 2,
+                            [&meshes](size_t i) {
+            union_pair(meshes[2 * i], meshes[2 * i + 1]);
+        });
+        for (size_t i = 1; 2 * i < meshes.size(); ++i)
+            meshes[i] = std::move(meshes[2 * i]);
+        meshes.resize((meshes.size() + 1) / 2);
+    }
+
+    return std::move(meshes.front());
+}
+
+// Check if the CGAL mesh can take part in the booleans.
+inline bool is_cgalmesh_eligible(const CGALMeshPtr &m)
+{
+    try {
+        if (!m || MeshBoolean::cgal::empty(*m))
+            return false;
+
+        if (MeshBoolean::cgal::does_self_intersect(*m))
+            return false;
+
+        if (!MeshBoolean::cgal::does_bound_a_volume(*m))
+            return false;
+    }
+    catch (...) { return false; }
+
+    return true;
+}
+
 template<class Ex, class It>
 std::vector<CGALMeshPtr> get_cgalptrs(Ex policy, const Range<It> &csgrange)
 {
@@ -86,6 +140,18 @@ std::vector<CGALMeshPtr> get_cgalptrs(Ex policy, const Range<It> &csgrange)
 
 } // namespace detail
 
+// Check if the part can be processed with CGAL. This method can be overriden
+// when a specific CSGPart type supports caching of the result.
+template<class CSGPartT>
+bool is_cgal_eligible(const CSGPartT &csgpart)
+{
+    // mesh can be nullptr if this is a stack push or pull
+    if (!get_mesh(csgpart) && get_stack_operation(csgpart) != CSGStackOp::Continue)
+        return true;
+
+    return detail_cgal::is_cgalmesh_eligible(get_cgalmesh(csgpart));
+}
+
 // Process the sequence of CSG parts with CGAL.
 template<class It>
 void perform_csgmesh_booleans(MeshBoolean::cgal::CGALMeshPtr &cgalm,
@@ -109,12 +175,37 @@ void perform_csgmesh_booleans(MeshBoolean::cgal::CGALMeshPtr &cgalm,
 
     std::vector<CGALMeshPtr> cgalmeshes = get_cgalptrs(ex_tbb, csgrange);
 
+    // Consecutive parts of the same stack level with the same union or difference
+    // operation are gathered: A - B - C == A - (B + C). The union of the batch is
+    // cheap (the parts are usually small and often disjoint, like drill holes) and
+    // done in parallel, then it is applied to the stack top with a single boolean.
+    std::vector<CGALMeshPtr> batch;
+    CSGType                  batch_op = CSGType::Union;
+    auto flush_batch = [&batch, &batch_op, &opstack]() {
+        if (batch.empty())
+            return;
+        CGALMeshPtr src = union_cgalptrs(ex_tbb, batch);
+        batch.clear();
+        perform_csg(batch_op, opstack.top().cgalptr, src);
+    };
+
     size_t csgidx = 0;
     for (auto &csgpart : csgrange) {
 
         auto op = get_operation(csgpart);
         CGALMeshPtr &cgalptr = cgalmeshes[csgidx++];
 
+        if (get_stack_operation(csgpart) == CSGStackOp::Continue && op != CSGType::Intersection) {
+            if (op != batch_op)
+                flush_batch();
+            batch_op = op;
+            if (cgalptr)
+                batch.emplace_back(std::move(cgalptr));
+            continue;
+        }
+
+        flush_batch();
+
         if (get_stack_operation(csgpart) == CSGStackOp::Push) {
             opstack.push(Frame{op});
             op = CSGType::Union;
@@ -132,6 +223,7 @@ void perform_csgmesh_booleans(MeshBoolean::cgal::CGALMeshPtr &cgalm,
             perform_csg(popop, dst, src);
         }
     }
+    flush_batch();
 
     cgalm = std::move(opstack.top().cgalptr);
 }
@@ -141,39 +233,19 @@ It check_csgmesh_booleans(const Range<It> &csgrange, Visitor &&vfn)
 {
     using namespace detail_cgal;
 
-    std::vector<CGALMeshPtr> cgalmeshes(csgrange.size());
-    auto check_part = [&csgrange, &cgalmeshes](size_t i)
+    // not std::vector<bool>, written from several threads
+    std::vector<char> eligible(csgrange.size(), false);
+    auto check_part = [&csgrange, &eligible](size_t i)
     {
         auto it = csgrange.begin();
         std::advance(it, i);
-        auto &csgpart = *it;
-        auto m = get_cgalmesh(csgpart);
-
-        // mesh can be nullptr if this is a stack push or pull
-        if (!get_mesh(csgpart) && get_stack_operation(csgpart) != CSGStackOp::Continue) {
-            cgalmeshes[i] = MeshBoolean::cgal::triangle_mesh_to_cgal(indexed_triangle_set{});
-            return;
-        }
-
-        try {
-            if (!m || MeshBoolean::cgal::empty(*m))
-                return;
-
-            if (MeshBoolean::cgal::does_self_intersect(*m))
-                return;
-
-            if (!MeshBoolean::cgal::does_bound_a_volume(*m))
-                return;
-        }
-        catch (...) { return; }
-
-        cgalmeshes[i] = std::move(m);
+        eligible[i] = is_cgal_eligible(*it);
     };
     execution::for_each(ex_tbb, size_t(0), csgrange.size(), check_part);
 
     It ret = csgrange.end();
     for (size_t i = 0; i < csgrange.size(); ++i) {
-        if (!cgalmeshes[i]) {
+        if (!eligible[i]) {
             auto it = csgrange.begin();
             std::advance(it, i);
             vfn(it);
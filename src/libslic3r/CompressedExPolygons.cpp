@@ -0,0 +1,111 @@
+#include "CompressedExPolygons.hpp"
+#include "Exception.hpp"
+
+#include <miniz.h>
+
+namespace Slic3r {
+
+static inline uint64_t zigzag_encode(int64_t v) { return (uint64_t(v) << 1) ^ uint64_t(v >> 63); }
+static inline int64_t  zigzag_decode(uint64_t v) { return int64_t(v >> 1) ^ -int64_t(v & 1); }
+
+static inline void write_varint(std::vector<uint8_t> &out, uint64_t v)
+{
+    while (v >= 0x80) {
+        out.emplace_back(uint8_t(v) | 0x80);
+        v >>= 7;
+    }
+    out.emplace_back(uint8_t(v));
+}
+
+static inline uint64_t read_varint(const uint8_t *&it, const uint8_t *end)
+{
+    uint64_t v     = 0;
+    int      shift = 0;
+    for (;;) {
+        if (it == end || shift > 63)
+            throw Slic3r::RuntimeError("CompressedExPolygons: corrupted stream");
+        uint8_t b = *it ++;
+        v |= uint64_t(b & 0x7f) << shift;
+        if ((b & 0x80) == 0)
+            return v;
+        shift += 7;
+    }
+}
+
+void CompressedExPolygons::assign(const ExPolygons &expolygons)
+{
+    this->clear();
+    if (expolygons.empty())
+        return;
+
+    // Varint stream: number of holes, then for the contour and each hole the number of points followed by the point deltas.
+    // Deltas continue across polygons, neighbor polygons are usually close to each other.
+    size_t num_points = 0;
+    for (const ExPolygon &expoly : expolygons) {
+        num_points += expoly.contour.size();
+        for (const Polygon &hole : expoly.holes)
+            num_points += hole.size();
+    }
+    std::vector<uint8_t> raw;
+    raw.reserve(num_points * 3 + expolygons.size() * 4);
+    Point prev(0, 0);
+    auto write_polygon = [&raw, &prev](const Polygon &polygon) {
+        write_varint(raw, polygon.size());
+        for (const Point &pt : polygon.points) {
+            write_varint(raw, zigzag_encode(int64_t(pt.x()) - int64_t(prev.x())));
+            write_varint(raw, zigzag_encode(int64_t(pt.y()) - int64_t(prev.y())));
+            prev = pt;
+        }
+    };
+    for (const ExPolygon &expoly : expolygons) {
+        write_varint(raw, expoly.holes.size());
+        write_polygon(expoly.contour);
+        for (const Polygon &hole : expoly.holes)
+            write_polygon(hole);
+    }
+
+    mz_ulong compressed_size = mz_compressBound(mz_ulong(raw.size()));
+    m_data.resize(compressed_size);
+    // The deltas are already small, the fastest level gains most of the ratio.
+    if (mz_compress2(m_data.data(), &compressed_size, raw.data(), mz_ulong(raw.size()), MZ_BEST_SPEED) != MZ_OK)
+        throw Slic3r::RuntimeError("CompressedExPolygons: compression failed");
+    m_data.resize(compressed_size);
+    m_data.shrink_to_fit();
+    m_raw_size       = raw.size();
+    m_num_expolygons = expolygons.size();
+}
+
+ExPolygons CompressedExPolygons::decompress() const
+{
+    ExPolygons out;
+    if (this->empty())
+        return out;
+
+    std::vector<uint8_t> raw(m_raw_size);
+    mz_ulong             raw_size = mz_ulong(m_raw_size);
+    if (mz_uncompress(raw.data(), &raw_size, m_data.data(), mz_ulong(m_data.size())) != MZ_OK || raw_size != m_raw_size)
+        throw Slic3r::RuntimeError("CompressedExPolygons: decompression failed");
+
+    const uint8_t *it  = raw.data();
+    const uint8_t *end = it + raw.size();
+    Point prev(0, 0);
+    auto read_polygon = [&it, end, &prev](Polygon &polygon) {
+        polygon.points.resize(size_t(read_varint(it, end)));
+        for (Point &pt : polygon.points) {
+            coord_t x = coord_t(prev.x() + zigzag_decode(read_varint(it, end)));
+            coord_t y = coord_t(prev.y() + zigzag_decode(read_varint(it, end)));
+            pt = prev = Point(x, y);
+        }
+    };
+    out.resize(m_num_expolygons);
+    for (ExPolygon &expoly : out) {
+        expoly.holes.resize(size_t(read_varint(it, end)));
+        read_polygon(expoly.contour);
+        for (Polygon &hole : expoly.holes)
+            read_polygon(hole);
+    }
+    assert(it == end);
+    return out;
+}
+
+} // namespace Slic3r
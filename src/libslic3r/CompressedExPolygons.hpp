@@ -0,0 +1,40 @@
+#ifndef slic3r_CompressedExPolygons_hpp_
+#define slic3r_CompressedExPolygons_hpp_
+
+#include "ExPolygon.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace Slic3r {
+
+/// <summary>
+/// Compact storage of ExPolygons, which are not accessed for a while.
+/// Points are stored as zigzag varint deltas to the previous point, the byte stream is then deflated.
+/// Decompression restores the exact same ExPolygons.
+/// </summary>
+class CompressedExPolygons
+{
+public:
+    CompressedExPolygons() = default;
+    explicit CompressedExPolygons(const ExPolygons &expolygons) { this->assign(expolygons); }
+
+    void        assign(const ExPolygons &expolygons);
+    ExPolygons  decompress() const;
+
+    bool        empty() const { return m_num_expolygons == 0; }
+    void        clear() { m_data.clear(); m_data.shrink_to_fit(); m_raw_size = 0; m_num_expolygons = 0; }
+    // Number of bytes held by the compressed stream.
+    size_t      memory_size() const { return m_data.capacity(); }
+
+private:
+    // Deflated varint stream.
+    std::vector<uint8_t> m_data;
+    // Size of the varint stream before deflating.
+    size_t               m_raw_size { 0 };
+    size_t               m_num_expolygons { 0 };
+};
+
+} // namespace Slic3r
+
+#endif // slic3r_CompressedExPolygons_hpp_
@@ -727,6 +727,12 @@ void ConfigDef::finalize()
             assert(! def.enum_def);
         }
     }
+    // The definitions are looked up by name for every access to a DynamicConfig value, hash them.
+    m_index.clear();
+    m_index.reserve(options.size());
+    for (const std::pair<const t_config_option_key, ConfigOptionDef> &kvp : options)
+        m_index.emplace(kvp.first, &kvp.second);
+    m_index_owner = this;
 }
 
 std::ostream& ConfigDef::print_cli_help(std::ostream& out, bool show_defaults, std::function<bool(const ConfigOptionDef &)> filter) const
@@ -1138,9 +1144,10 @@ void ConfigBase::apply_only(const ConfigBase &other, const t_config_option_keys
 // Are the two configs equal? Ignoring options not present in both configs.
 bool ConfigBase::equals(const ConfigBase &other) const
 { 
-    if(this->keys().size() != other.keys().size())
+    const t_config_option_keys keys = this->keys();
+    if (keys.size() != other.keys().size())
         return false;
-    for (const t_config_option_key &opt_key : this->keys()) {
+    for (const t_config_option_key &opt_key : keys) {
         const ConfigOption *this_opt  = this->option(opt_key);
         const ConfigOption *other_opt = other.option(opt_key);
         if (this_opt != nullptr && other_opt != nullptr && *this_opt != *other_opt)
@@ -2292,10 +2299,11 @@ static inline bool dynamic_config_iterate(const DynamicConfig &lhs, const Dynami
 {
     std::map<t_config_option_key, std::unique_ptr<ConfigOption>>::const_iterator i = lhs.cbegin();
     std::map<t_config_option_key, std::unique_ptr<ConfigOption>>::const_iterator j = rhs.cbegin();
-    while (i != lhs.cend() && j != rhs.cend())
-        if (i->first < j->first)
+    while (i != lhs.cend() && j != rhs.cend()) {
+        const int cmp = i->first.compare(j->first);
+        if (cmp < 0)
             ++ i;
-        else if (i->first > j->first)
+        else if (cmp > 0)
             ++ j;
         else {
             assert(i->first == j->first);
@@ -2305,6 +2313,7 @@ static inline bool dynamic_config_iterate(const DynamicConfig &lhs, const Dynami
             ++ i;
             ++ j;
         }
+    }
     // Finished to the end.
     return false;
 }
@@ -35,6 +35,7 @@
 #include <string_view>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 #include <float.h>
 #include "libslic3r.h"
@@ -2812,8 +2813,12 @@ public:
     t_optiondef_map         					options;
     std::map<size_t, const ConfigOptionDef*>	by_serialization_key_ordinal;
 
-    bool                    has(const t_config_option_key &opt_key) const { return this->options.count(opt_key) > 0; }
+    bool                    has(const t_config_option_key &opt_key) const { return this->get(opt_key) != nullptr; }
     const ConfigOptionDef*  get(const t_config_option_key &opt_key) const {
+        if (m_index_owner == this && m_index.size() == this->options.size()) {
+            auto it = m_index.find(opt_key);
+            return (it == m_index.end()) ? nullptr : it->second;
+        }
         t_optiondef_map::iterator it = const_cast<ConfigDef*>(this)->options.find(opt_key);
         return (it == this->options.end()) ? nullptr : &it->second;
     }
@@ -2833,8 +2838,14 @@ public:
 
 protected:
     ConfigOptionDef*        add(const t_config_option_key &opt_key, ConfigOptionType type);
-    // Finalize open / close enums, validate everything.
+    // Finalize open / close enums, validate everything, build the hash index of options.
     void                    finalize();
+
+private:
+    // Hash index into options, filled in by finalize(). Only used by the instance that built it (not by its copies)
+    // and while no option was added or removed since.
+    std::unordered_map<t_config_option_key, const ConfigOptionDef*> m_index;
+    const ConfigDef                                                *m_index_owner = nullptr;
 };
 
 // A pure interface to resolving ConfigOptions.
@@ -17,6 +17,7 @@
 #include "../Print.hpp"
 #include "../PrintConfig.hpp"
 #include "../Surface.hpp"
+#include "../Thread.hpp"
 // for Arachne based infills
 #include "../PerimeterGenerator.hpp"
 
@@ -117,7 +118,7 @@ struct NormalizeVisitor : public ExtrusionVisitor {
             }
         }
     }
-} normalize_visitor;
+};
 
 struct SurfaceFillParams : FillParams
 {
@@ -931,15 +932,19 @@ void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive:
         }
         fills_by_priority.clear();
     };
-    //surface_fills is sorted by region_id
-    size_t current_region_id = -1;
+    // Prepare one filler per surface fill, then generate the infill of all the islands in parallel:
+    // a single layer of a large flat print may hold a lot of islands and only a few layers to parallelize over.
+    struct IslandFill {
+        size_t                                     surface_fill_id;
+        size_t                                     expolygon_id;
+        std::unique_ptr<ExtrusionEntityCollection> fills;
+    };
+    std::vector<std::unique_ptr<Fill>> fillers(surface_fills.size());
+    std::vector<float>                 perimeter_spacings(surface_fills.size(), 0.f);
+    std::vector<IslandFill>            island_fills;
 	size_t first_object_layer_id = this->object()->get_layer(0)->id();
-    for (SurfaceFill &surface_fill : surface_fills) {
-        // store the region fill when changing region. 
-        if (current_region_id != size_t(-1) && current_region_id != surface_fill.region_id) {
-            store_fill(current_region_id);
-        }
-        current_region_id = surface_fill.region_id;
+    for (size_t surface_fill_id = 0; surface_fill_id < surface_fills.size(); ++ surface_fill_id) {
+        SurfaceFill &surface_fill = surface_fills[surface_fill_id];
         const LayerRegion* layerm = this->m_regions[surface_fill.region_id];
         
         // Create the filler object.
@@ -1001,6 +1006,7 @@ void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive:
             perimeter_spacing = std::min(layerm->flow(frPerimeter).spacing(), layerm->flow(frExternalPerimeter).spacing());
         else //if(layerm->region().config().perimeters > 1)
             perimeter_spacing = layerm->flow(frPerimeter).spacing();
+        perimeter_spacings[surface_fill_id] = perimeter_spacing;
 
         // Used by the concentric infill pattern to clip the loops to create extrusion paths.
         f->loop_clipping = scale_t(layerm->region().config().get_computed_value("seam_gap", surface_fill.params.extruder - 1) * surface_fill.params.flow.nozzle_diameter());
@@ -1021,146 +1027,176 @@ void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive:
         //simplify (also, it's possible rn that some point are below EPSILON distance).
         ensure_valid(surface_fill.expolygons, surface_fill.params.fill_resolution);
 
-        //store default values, before modification.
-        bool dont_adjust = surface_fill.params.dont_adjust;
-        float density = surface_fill.params.density;
-        for (ExPolygon &expoly : surface_fill.expolygons) {
-            //set overlap polygons
-            f->no_overlap_expolygons.clear();
-            if (surface_fill.params.config->perimeters > 0) {
-                f->overlap = surface_fill.params.config->infill_overlap.get_abs_value((perimeter_spacing + (f->get_spacing())) / 2);
-                if (f->overlap != 0) {
-                    f->no_overlap_expolygons = intersection_ex(layerm->fill_no_overlap_expolygons(), ExPolygons() = {expoly});
-                } else {
-                    f->no_overlap_expolygons.push_back(expoly);
-                }
+        for (size_t expolygon_id = 0; expolygon_id < surface_fill.expolygons.size(); ++ expolygon_id)
+            if (!surface_fill.expolygons[expolygon_id].contour.empty())
+                island_fills.push_back({ surface_fill_id, expolygon_id, nullptr });
+        fillers[surface_fill_id] = std::move(f);
+    }
+
+    auto fill_island = [this, &surface_fills, &fillers, &perimeter_spacings, &island_fills](size_t island_fill_id) {
+        IslandFill        &island_fill  = island_fills[island_fill_id];
+        SurfaceFill       &surface_fill = surface_fills[island_fill.surface_fill_id];
+        const LayerRegion *layerm       = this->m_regions[surface_fill.region_id];
+        // Each island works on its own copy of the filler, of the fill parameters and of the surface.
+        std::unique_ptr<Fill> f(fillers[island_fill.surface_fill_id]->clone());
+        SurfaceFillParams     params  = surface_fill.params;
+        Surface               surface = surface_fill.surface;
+        ExPolygon            &expoly  = surface_fill.expolygons[island_fill.expolygon_id];
+        const float           perimeter_spacing = perimeter_spacings[island_fill.surface_fill_id];
+
+        //set overlap polygons
+        f->no_overlap_expolygons.clear();
+        if (params.config->perimeters > 0) {
+            f->overlap = params.config->infill_overlap.get_abs_value((perimeter_spacing + (f->get_spacing())) / 2);
+            if (f->overlap != 0) {
+                f->no_overlap_expolygons = intersection_ex(layerm->fill_no_overlap_expolygons(), ExPolygons() = {expoly});
             } else {
-                f->overlap = 0;
                 f->no_overlap_expolygons.push_back(expoly);
             }
+        } else {
+            f->overlap = 0;
+            f->no_overlap_expolygons.push_back(expoly);
+        }
 
-            //set default param (that can be modified by bridge thing)
-            surface_fill.params.dont_adjust = dont_adjust;
-            surface_fill.params.bridge_offset = 0;
-            surface_fill.params.density = density;
-            surface_fill.params.layer_height = m_regions[surface_fill.region_id]->layer()->height;
-            surface_fill.params.use_arachne   = (layerm->region().config().perimeter_generator == PerimeterGeneratorType::Arachne &&
-                                               surface_fill.params.pattern == ipConcentric) ||
-                                              surface_fill.params.pattern == ipEnsuring;
-
-            //init the surface with the current polygon
-            if (!expoly.contour.empty()) {
-                surface_fill.surface.expolygon = std::move(expoly);
-
-                //adjust the bridge density
-                if (surface_fill.params.flow.bridge() && surface_fill.params.density > 0.99 /*&& layerm->region()->config().bridge_overlap.get_abs_value(1) != 1*/) {
-                    // bridge have their own spacing, don't try to align it with normal infill.
-                    surface_fill.params.max_sparse_infill_spacing = 0;
-                    ////varies the overlap to have the best coverage for the bridge
-                    //surface_fill.params.density *= float(layerm->region()->config().bridge_overlap.get_abs_value(1));
-                    double min_spacing = 0.999 * surface_fill.params.spacing / surface_fill.params.config->bridge_overlap.get_abs_value(surface_fill.params.density);
-                    double max_spacing = 1.001 * surface_fill.params.spacing / surface_fill.params.config->bridge_overlap_min.get_abs_value(surface_fill.params.density);
-                    double factor = 1.00001;
-                    if (min_spacing < max_spacing * 1.01) {
-                        // create a bouding box of the rotated surface
-                        coord_t bounding_box_size_x = 0;
-                        coord_t bounding_box_min_x = 0;
-                        ExPolygons expolys;
-                        if (surface_fill.params.bridge_angle > 0 && !f->no_overlap_expolygons.empty()) {
-                            //take only the no-overlap area
-                            expolys = offset_ex(intersection_ex(ExPolygons{ ExPolygon{surface_fill.surface.expolygon.contour} }, f->no_overlap_expolygons), -scale_t(surface_fill.params.spacing) / 2 - 10);
-                        } else {
-                            expolys = offset_ex(ExPolygon{surface_fill.surface.expolygon.contour}, -scale_t(surface_fill.params.spacing) / 2 - 10);
-                        }
-                        // if nothing after collapse, then go to next surface_fill.expolygon
-                        if (expolys.empty())
-                            continue;
-
-                        BoundingBox bb;
-                        bool first = true;
-                        for (ExPolygon& expoly : expolys) {
-                            expoly.holes.clear();
-                            expoly.rotate(PI / 2 + (surface_fill.params.bridge_angle < 0 ? surface_fill.params.angle : surface_fill.params.bridge_angle));
-                            if (first) {
-                                bb = expoly.contour.bounding_box();
-                                first = false;
-                            } else {
-                                bb.merge(expoly.contour.points);
-                            }
-                        }
-                        bounding_box_size_x = bb.size().x();
-                        bounding_box_min_x = bb.min.x();
+        //set default param (that can be modified by bridge thing)
+        params.bridge_offset = 0;
+        params.layer_height = m_regions[surface_fill.region_id]->layer()->height;
+        params.use_arachne   = (layerm->region().config().perimeter_generator == PerimeterGeneratorType::Arachne &&
+                                params.pattern == ipConcentric) ||
+                               params.pattern == ipEnsuring;
+
+        //init the surface with the current polygon
+        surface.expolygon = std::move(expoly);
+
+        //adjust the bridge density
+        if (params.flow.bridge() && params.density > 0.99 /*&& layerm->region()->config().bridge_overlap.get_abs_value(1) != 1*/) {
+            // bridge have their own spacing, don't try to align it with normal infill.
+            params.max_sparse_infill_spacing = 0;
+            ////varies the overlap to have the best coverage for the bridge
+            //params.density *= float(layerm->region()->config().bridge_overlap.get_abs_value(1));
+            double min_spacing = 0.999 * params.spacing / params.config->bridge_overlap.get_abs_value(params.density);
+            double max_spacing = 1.001 * params.spacing / params.config->bridge_overlap_min.get_abs_value(params.density);
+            double factor = 1.00001;
+            if (min_spacing < max_spacing * 1.01) {
+                // create a bouding box of the rotated surface
+                coord_t bounding_box_size_x = 0;
+                coord_t bounding_box_min_x = 0;
+                ExPolygons expolys;
+                if (params.bridge_angle > 0 && !f->no_overlap_expolygons.empty()) {
+                    //take only the no-overlap area
+                    expolys = offset_ex(intersection_ex(ExPolygons{ ExPolygon{surface.expolygon.contour} }, f->no_overlap_expolygons), -scale_t(params.spacing) / 2 - 10);
+                } else {
+                    expolys = offset_ex(ExPolygon{surface.expolygon.contour}, -scale_t(params.spacing) / 2 - 10);
+                }
+                // if nothing after collapse, then go to next surface_fill.expolygon
+                if (expolys.empty())
+                    return;
+
+                BoundingBox bb;
+                bool first = true;
+                for (ExPolygon& expoly : expolys) {
+                    expoly.holes.clear();
+                    expoly.rotate(PI / 2 + (params.bridge_angle < 0 ? params.angle : params.bridge_angle));
+                    if (first) {
+                        bb = expoly.contour.bounding_box();
+                        first = false;
+                    } else {
+                        bb.merge(expoly.contour.points);
+                    }
+                }
+                bounding_box_size_x = bb.size().x();
+                bounding_box_min_x = bb.min.x();
 
-                        //compute the dist
-                        double new_spacing = unscaled(f->_adjust_solid_spacing(bounding_box_size_x, scale_t(min_spacing), 2));
-                        if (new_spacing <= max_spacing) {
-                            surface_fill.params.density = factor * surface_fill.params.spacing / new_spacing;
+                //compute the dist
+                double new_spacing = unscaled(f->_adjust_solid_spacing(bounding_box_size_x, scale_t(min_spacing), 2));
+                if (new_spacing <= max_spacing) {
+                    params.density = factor * params.spacing / new_spacing;
+                } else {
+                    double new_spacing2 = unscaled(f->_adjust_solid_spacing(bounding_box_size_x, scale_t(min_spacing * 1.999 - new_spacing), 2));
+                    if (new_spacing2 < min_spacing) {
+                        if (min_spacing - new_spacing2 < new_spacing - max_spacing) {
+                            params.density = params.config->bridge_overlap.get_abs_value(params.density);
                         } else {
-                            double new_spacing2 = unscaled(f->_adjust_solid_spacing(bounding_box_size_x, scale_t(min_spacing * 1.999 - new_spacing), 2));
-                            if (new_spacing2 < min_spacing) {
-                                if (min_spacing - new_spacing2 < new_spacing - max_spacing) {
-                                    surface_fill.params.density = surface_fill.params.config->bridge_overlap.get_abs_value(surface_fill.params.density);
-                                } else {
-                                    surface_fill.params.density = surface_fill.params.config->bridge_overlap_min.get_abs_value(surface_fill.params.density);
-                                }
-                            } else {
-                                //use the highest density
-                                surface_fill.params.density = surface_fill.params.config->bridge_overlap.get_abs_value(surface_fill.params.density);
-                            }
+                            params.density = params.config->bridge_overlap_min.get_abs_value(params.density);
                         }
-                        Polygon poly = surface_fill.surface.expolygon.contour;
-                        poly.rotate(PI / 2 + (surface_fill.params.bridge_angle < 0 ? surface_fill.params.angle : surface_fill.params.bridge_angle));
-                        surface_fill.params.dont_adjust = true;
-                        surface_fill.params.bridge_offset = std::abs(poly.bounding_box().min.x() - bounding_box_min_x);
+                    } else {
+                        //use the highest density
+                        params.density = params.config->bridge_overlap.get_abs_value(params.density);
                     }
                 }
+                Polygon poly = surface.expolygon.contour;
+                poly.rotate(PI / 2 + (params.bridge_angle < 0 ? params.angle : params.bridge_angle));
+                params.dont_adjust = true;
+                params.bridge_offset = std::abs(poly.bounding_box().min.x() - bounding_box_min_x);
+            }
+        }
 
-                //make fill
-                while ((size_t)surface_fill.params.priority >= fills_by_priority.size())
-                    fills_by_priority.emplace_back();
-                // note: fills_by_priority[idx] is a vector that store all the entities of this priority, but that can be in multiple islands
-                //       the collection in fills_by_priority[idx][idx2) can be reordered, so put evrythgin in a new unorderable collection if it'ts needed
-                fills_by_priority[(size_t)surface_fill.params.priority].push_back(new ExtrusionEntityCollection());
-                f->fill_surface_extrusion(&surface_fill.surface, surface_fill.params, fills_by_priority[(size_t)surface_fill.params.priority].back()->set_entities());
-                // normalize result, just in case the filling algorihtm is messing things up (some are).
-                fills_by_priority[(size_t)surface_fill.params.priority].back()->visit(normalize_visitor);
+        //make fill
+        // note: the collection can be reordered, so it's put into a new unorderable collection by store_fill if it's needed
+        island_fill.fills = std::make_unique<ExtrusionEntityCollection>();
+        f->fill_surface_extrusion(&surface, params, island_fill.fills->set_entities());
+        // normalize result, just in case the filling algorihtm is messing things up (some are).
+        NormalizeVisitor normalize_visitor;
+        island_fill.fills->visit(normalize_visitor);
 #if _DEBUG
-                //check no over or underextrusion if fill_exactly
-                if (surface_fill.params.fill_exactly && surface_fill.params.density == 1 && !surface_fill.params.flow.bridge()) {
-                    ExtrusionVolume compute_volume;
-                    ExtrusionVolume compute_volume_no_gap_fill(false);
-                    GetPathsVisitor get_path;
-                    //check that it doesn't overextrude
-                    for(size_t idx = 0; idx < fills_by_priority[(size_t)surface_fill.params.priority].back()->size(); ++idx){
-                        fills_by_priority[(size_t)surface_fill.params.priority].back()->entities()[idx]->visit(compute_volume);
-                        fills_by_priority[(size_t)surface_fill.params.priority].back()->entities()[idx]->visit(compute_volume_no_gap_fill);
-                        fills_by_priority[(size_t)surface_fill.params.priority].back()->entities()[idx]->visit(get_path);
-                    }
-                    ExPolygons temp = f->no_overlap_expolygons.empty() ?
-                                        ExPolygons{surface_fill.surface.expolygon} :
-                                        intersection_ex(ExPolygons{surface_fill.surface.expolygon}, f->no_overlap_expolygons);
-                    double real_surface = 0;
-                    for(auto &t : temp) real_surface += t.area();
-                    assert(compute_volume.volume < unscaled(unscaled(surface_fill.surface.area())) * surface_fill.params.layer_height * surface_fill.params.flow_mult + EPSILON
-                        || f->debug_verify_flow_mult <= 0.80001);
-                    double area = unscaled(unscaled(real_surface));
-                    if(surface_fill.surface.has_pos_top())
-                        area *= surface_fill.params.config->fill_top_flow_ratio.get_abs_value(1);
-                    //TODO: over-bridge mod
-                    if(surface_fill.params.config->over_bridge_flow_ratio.get_abs_value(1) == 1){
-                        assert(compute_volume.volume <= area * surface_fill.params.layer_height * 1.001 || f->debug_verify_flow_mult <= 0.8);
-                        if(compute_volume.volume > 0) //can fail for thin regions
-                            assert(
-                                compute_volume.volume >= area * surface_fill.params.layer_height * 0.999 ||
-                                f->debug_verify_flow_mult >= 1.3 ||
-                                f->debug_verify_flow_mult ==
-                                    0 // sawtooth output more filament,as it's 3D (debug_verify_flow_mult==0)
-                                || area < std::max(1., surface_fill.params.config->solid_infill_below_area.value) ||
-                                area < std::max(1., surface_fill.params.config->solid_infill_below_layer_area.value));
-                        }
-                    }
-#endif
+        //check no over or underextrusion if fill_exactly
+        if (params.fill_exactly && params.density == 1 && !params.flow.bridge()) {
+            ExtrusionVolume compute_volume;
+            ExtrusionVolume compute_volume_no_gap_fill(false);
+            GetPathsVisitor get_path;
+            //check that it doesn't overextrude
+            for(size_t idx = 0; idx < island_fill.fills->size(); ++idx){
+                island_fill.fills->entities()[idx]->visit(compute_volume);
+                island_fill.fills->entities()[idx]->visit(compute_volume_no_gap_fill);
+                island_fill.fills->entities()[idx]->visit(get_path);
+            }
+            ExPolygons temp = f->no_overlap_expolygons.empty() ?
+                                ExPolygons{surface.expolygon} :
+                                intersection_ex(ExPolygons{surface.expolygon}, f->no_overlap_expolygons);
+            double real_surface = 0;
+            for(auto &t : temp) real_surface += t.area();
+            assert(compute_volume.volume < unscaled(unscaled(surface.area())) * params.layer_height * params.flow_mult + EPSILON
+                || f->debug_verify_flow_mult <= 0.80001);
+            double area = unscaled(unscaled(real_surface));
+            if(surface.has_pos_top())
+                area *= params.config->fill_top_flow_ratio.get_abs_value(1);
+            //TODO: over-bridge mod
+            if(params.config->over_bridge_flow_ratio.get_abs_value(1) == 1){
+                assert(compute_volume.volume <= area * params.layer_height * 1.001 || f->debug_verify_flow_mult <= 0.8);
+                if(compute_volume.volume > 0) //can fail for thin regions
+                    assert(
+                        compute_volume.volume >= area * params.layer_height * 0.999 ||
+                        f->debug_verify_flow_mult >= 1.3 ||
+                        f->debug_verify_flow_mult ==
+                            0 // sawtooth output more filament,as it's 3D (debug_verify_flow_mult==0)
+                        || area < std::max(1., params.config->solid_infill_below_area.value) ||
+                        area < std::max(1., params.config->solid_infill_below_layer_area.value));
+                }
             }
+#endif
+    };
+    if (island_fills.size() > 1)
+        Slic3r::parallel_for(size_t(0), island_fills.size(), fill_island);
+    else if (island_fills.size() == 1)
+        fill_island(0);
+
+    //surface_fills is sorted by region_id
+    size_t current_region_id = -1;
+    auto   it_island_fill    = island_fills.begin();
+    for (size_t surface_fill_id = 0; surface_fill_id < surface_fills.size(); ++ surface_fill_id) {
+        const SurfaceFill &surface_fill = surface_fills[surface_fill_id];
+        // store the region fill when changing region. 
+        if (current_region_id != size_t(-1) && current_region_id != surface_fill.region_id) {
+            store_fill(current_region_id);
+        }
+        current_region_id = surface_fill.region_id;
+        for (; it_island_fill != island_fills.end() && it_island_fill->surface_fill_id == surface_fill_id; ++ it_island_fill) {
+            if (! it_island_fill->fills)
+                continue;
+            while ((size_t)surface_fill.params.priority >= fills_by_priority.size())
+                fills_by_priority.emplace_back();
+            // note: fills_by_priority[idx] is a vector that store all the entities of this priority, but that can be in multiple islands
+            fills_by_priority[(size_t)surface_fill.params.priority].push_back(it_island_fill->fills.release());
         }
     }
     if(current_region_id != size_t(-1))
@@ -1169,6 +1205,7 @@ void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive:
     // add thin fill regions
     // i.e, move from layerm.m_thin_fills to layerm.m_fills
     // note: if some need to be ordered, please put them into an unsaortable collection before.
+    NormalizeVisitor normalize_visitor;
 	for (LayerSlice &lslice : this->lslices_ex) {
 		for (LayerIsland &island : lslice.islands) {
 			if (! island.thin_fills.empty()) {
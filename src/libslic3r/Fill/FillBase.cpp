@@ -370,13 +370,14 @@ Fill::do_gap_fill(const ExPolygons& gapfill_areas, const FillParams& params, Ext
     ExPolygons gapfill_areas_collapsed = offset2_ex(gapfill_areas, double(-min / 2), double(+min / 2));
     double minarea = double(params.flow.scaled_width()) * double(params.flow.scaled_width());
     if (params.config != nullptr) minarea = scale_d(params.config->gap_fill_min_area.get_abs_value(params.flow.width())) * double(params.flow.scaled_width());
-    for (const ExPolygon& ex : gapfill_areas_collapsed) {
+    Geometry::build_medial_axes(gapfill_areas_collapsed.size(), [&](size_t idx, ThickPolylines &polylines_out) {
+        const ExPolygon &ex = gapfill_areas_collapsed[idx];
         //remove too small gaps that are too hard to fill.
         //ie one that are smaller than an extrusion with width of min and a length of max.
         if (ex.area() > minarea) {
-            Geometry::MedialAxis{ ex, params.flow.scaled_width() * 2, params.flow.scaled_width() / 5, coord_t(params.flow.height()) }.build(polylines_gapfill);
+            Geometry::MedialAxis{ ex, params.flow.scaled_width() * 2, params.flow.scaled_width() / 5, coord_t(params.flow.height()) }.build(polylines_out);
         }
-    }
+    }, polylines_gapfill);
     if (!polylines_gapfill.empty() && !params.role.is_bridge()) {
         //test
 #ifdef _DEBUG
@@ -324,7 +324,8 @@ FillConcentricWGapFill::fill_surface_extrusion(
                     offset2_ex(bunch_2_gaps[idx_bunch], -max / 2, +max / 2),
                     ApplySafetyOffset::Yes);
                 ThickPolylines polylines;
-                for (const ExPolygon& ex : gaps_ex) {
+                Geometry::build_medial_axes(gaps_ex.size(), [&](size_t idx, ThickPolylines &polylines_out) {
+                    const ExPolygon &ex = gaps_ex[idx];
                     //remove too small gaps that are too hard to fill.
                     //ie one that are smaller than an extrusion with width of min and a length of max.
                     if (ex.area() > min_gapfill_area) {
@@ -336,9 +337,9 @@ FillConcentricWGapFill::fill_surface_extrusion(
                             md.set_extension_length(gapfill_extension);
                         }
                         md.set_biggest_width(max);
-                        md.build(polylines);
+                        md.build(polylines_out);
                     }
-                }
+                }, polylines);
                 ////search if we can add some at the end of a leaf
                 //for (size_t idx_polyline = 0; idx_polyline < polylines.size(); ++idx_polyline) {
                 //    ThickPolyline& poly = polylines[idx_polyline];
@@ -9,6 +9,10 @@
 #include <cmath>
 #include <algorithm>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
 
 #include "FillGyroid.hpp"
 
@@ -66,7 +70,7 @@ static inline Polyline make_wave(
     return polyline;
 }
 
-static std::vector<Vec2d> make_one_period(double width, double scaleFactor, double z_cos, double z_sin, bool vertical, bool flip, double tolerance)
+static std::vector<Vec2d> make_one_period(double width, double z_cos, double z_sin, bool vertical, bool flip, double tolerance)
 {
     std::vector<Vec2d> points;
     double dx = M_PI_2; // exact coordinates on main inflexion lobes
@@ -106,6 +110,39 @@ static std::vector<Vec2d> make_one_period(double width, double scaleFactor, doub
     return points;
 }
 
+// One period of the odd and even waves. Their evaluation is the costly part of the gyroid pattern,
+// the full pattern is then made by repeating and shifting them.
+struct GyroidPeriods
+{
+    std::vector<Vec2d> odd;
+    std::vector<Vec2d> even;
+};
+
+// The periods only depend on z (in grid units), the period length and the tolerance,
+// so all the islands of a layer and all the objects sharing the infill settings reuse them.
+static std::shared_ptr<const GyroidPeriods> gyroid_periods(double z, double width, double z_cos, double z_sin, bool vertical, double tolerance)
+{
+    using Key = std::tuple<double, double, double>;
+    static std::mutex                                           mutex;
+    static std::map<Key, std::shared_ptr<const GyroidPeriods>> cache;
+    // make_one_period() stops at the first period.
+    const Key key { z, std::min(2 * M_PI, width), tolerance };
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (auto it = cache.find(key); it != cache.end())
+            return it->second;
+    }
+    auto periods = std::make_shared<GyroidPeriods>();
+    bool flip    = !vertical;
+    periods->odd  = make_one_period(width, z_cos, z_sin, vertical, flip, tolerance);
+    periods->even = make_one_period(width, z_cos, z_sin, vertical, !flip, tolerance);
+    std::lock_guard<std::mutex> lock(mutex);
+    // Keep the cache small, a print rarely uses more than a few hundreds different layers z for the gyroid.
+    if (cache.size() >= 4096)
+        cache.clear();
+    return cache.emplace(key, std::move(periods)).first->second;
+}
+
 static Polylines make_gyroid_waves(coordf_t gridZ, coordf_t scaleFactor, double width, double height, double tolerance)
 {
 
@@ -126,18 +163,19 @@ static Polylines make_gyroid_waves(coordf_t gridZ, coordf_t scaleFactor, double
         std::swap(width,height);
     }
 
-    std::vector<Vec2d> one_period_odd = make_one_period(width, scaleFactor, z_cos, z_sin, vertical, flip, tolerance); // creates one period of the waves, so it doesn't have to be recalculated all the time
-    flip = !flip;                                                                   // even polylines are a bit shifted
-    std::vector<Vec2d> one_period_even = make_one_period(width, scaleFactor, z_cos, z_sin, vertical, flip, tolerance);
+    // creates one period of the waves, so it doesn't have to be recalculated all the time
+    // even polylines are a bit shifted
+    std::shared_ptr<const GyroidPeriods> periods = gyroid_periods(z, width, z_cos, z_sin, vertical, tolerance);
+    flip = !flip;
     Polylines result;
 
     for (double y0 = lower_bound; y0 < upper_bound + EPSILON; y0 += M_PI) {
         // creates odd polylines
-        result.emplace_back(make_wave(one_period_odd, width, height, y0, scaleFactor, z_cos, z_sin, vertical, flip));
+        result.emplace_back(make_wave(periods->odd, width, height, y0, scaleFactor, z_cos, z_sin, vertical, flip));
         // creates even polylines
         y0 += M_PI;
         if (y0 < upper_bound + EPSILON) {
-            result.emplace_back(make_wave(one_period_even, width, height, y0, scaleFactor, z_cos, z_sin, vertical, flip));
+            result.emplace_back(make_wave(periods->even, width, height, y0, scaleFactor, z_cos, z_sin, vertical, flip));
         }
     }
 
@@ -461,7 +461,7 @@ GCodeGenerator::ObjectsLayerToPrint GCodeGenerator::collect_layers_to_print(cons
         if (layers_to_print.size() == 1u && !object.print()->config().allow_empty_layers.value) {
             if (!has_extrusions)
                 throw Slic3r::SlicingError(_u8L("There is an object with no extrusions in the first layer.") + "\n" +
-                                           _u8L("Object name") + ": " + object.model_object()->name);
+                                           _u8L("Object name") + ": " + object.model_objects_names());
         }
 
         // In case there are extrusions on this layer, check there is a layer to lay it on.
@@ -512,7 +512,7 @@ GCodeGenerator::ObjectsLayerToPrint GCodeGenerator::collect_layers_to_print(cons
         if (i < warning_ranges.size())
             warning += _u8L("(Some lines not shown)") + "\n";
         warning += "\n";
-        warning += Slic3r::format(_u8L("Object name: %1%"), object.model_object()->name) + "\n\n"
+        warning += Slic3r::format(_u8L("Object name: %1%"), object.model_objects_names()) + "\n\n"
             + _u8L("Make sure the object is printable. This is usually caused by negligibly small extrusions or by a faulty model. "
                 "Try to repair the model or change its orientation on the bed.");
 
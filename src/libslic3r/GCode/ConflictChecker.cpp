@@ -6,7 +6,6 @@
 #include "ConflictChecker.hpp"
 
 #include <tbb/parallel_for.h>
-#include <tbb/concurrent_vector.h>
 
 #include <map>
 #include <functional>
@@ -229,14 +228,21 @@ double LinesBucketQueue::removeLowests()
     return curHeight;
 }
 
-LineWithIDs LinesBucketQueue::getCurLines() const
+LinesBucketPiles LinesBucketQueue::getCurPiles() const
+{
+    LinesBucketPiles piles;
+    for (const LinesBucket &bucket : _buckets)
+        if (bucket.valid())
+            piles.emplace_back(&bucket, bucket.curPileIdx());
+    return piles;
+}
+
+LineWithIDs LinesBucketQueue::getLines(const LinesBucketPiles &piles)
 {
     LineWithIDs lines;
-    for (const LinesBucket &bucket : _buckets) {
-        if (bucket.valid()) {
-            LineWithIDs tmpLines = bucket.curLines();
-            lines.insert(lines.end(), tmpLines.begin(), tmpLines.end());
-        }
+    for (const auto &[bucket, pile_idx] : piles) {
+        LineWithIDs tmpLines = bucket->lines(pile_idx);
+        lines.insert(lines.end(), tmpLines.begin(), tmpLines.end());
     }
     return lines;
 }
@@ -290,19 +296,43 @@ std::pair<std::vector<ExtrusionPaths>, std::vector<ExtrusionPaths>> getAllLayers
 ConflictComputeOpt ConflictChecker::find_inter_of_lines(const LineWithIDs &lines)
 {
     using namespace RasterizationImpl;
-    std::map<IndexPair, std::vector<int>> indexToLine;
-
-    for (int i = 0; i < (int)lines.size(); ++i) {
-        const LineWithID &l1      = lines[i];
-        auto              indexes = line_rasterization(l1._line);
-        for (auto index : indexes) {
-            const auto &possibleIntersectIdxs = indexToLine[index];
-            for (auto possibleIntersectIdx : possibleIntersectIdxs) {
-                const LineWithID &l2 = lines[possibleIntersectIdx];
-                if (auto interRes = line_intersect(l1, l2); interRes.has_value()) { return interRes; }
+    struct CellEntry
+    {
+        IndexPair cell;
+        int       line_idx;
+    };
+    std::vector<CellEntry> entries;
+    entries.reserve(lines.size() * 2);
+    for (int i = 0; i < (int)lines.size(); ++i)
+        for (const IndexPair &cell : line_rasterization(lines[i]._line))
+            entries.push_back({cell, i});
+
+    // Group the entries by cell and inside a cell by instance, the line index keeps the order deterministic.
+    auto owner = [&lines](int line_idx) { return std::make_pair(lines[line_idx]._obj_id, lines[line_idx]._inst_id); };
+    std::sort(entries.begin(), entries.end(), [&owner](const CellEntry &e1, const CellEntry &e2) {
+        if (e1.cell != e2.cell)
+            return e1.cell < e2.cell;
+        auto o1 = owner(e1.line_idx), o2 = owner(e2.line_idx);
+        return o1 < o2 || (o1 == o2 && e1.line_idx < e2.line_idx);
+    });
+
+    for (auto cell_begin = entries.begin(); cell_begin != entries.end();) {
+        auto cell_end = std::find_if(cell_begin, entries.end(), [&cell_begin](const CellEntry &e) { return e.cell != cell_begin->cell; });
+        // Most of the cells are covered by a single instance, there is nothing to test.
+        if (owner(cell_begin->line_idx) != owner((cell_end - 1)->line_idx)) {
+            for (auto owner_begin = cell_begin; owner_begin != cell_end;) {
+                auto owner_end = std::find_if(owner_begin, cell_end, [&owner, &owner_begin](const CellEntry &e) {
+                    return owner(e.line_idx) != owner(owner_begin->line_idx);
+                });
+                // test only against the lines of the following instances, the preceding ones were already tested
+                for (auto it1 = owner_begin; it1 != owner_end; ++it1)
+                    for (auto it2 = owner_end; it2 != cell_end; ++it2)
+                        if (auto interRes = line_intersect(lines[it1->line_idx], lines[it2->line_idx]); interRes.has_value())
+                            return interRes;
+                owner_begin = owner_end;
             }
-            indexToLine[index].push_back(i);
         }
+        cell_begin = cell_end;
     }
     return {};
 }
@@ -335,35 +365,35 @@ ConflictResultOpt ConflictChecker::find_inter_of_lines_in_diff_objs(SpanOfConstP
     }
     conflictQueue.build_queue();
 
-    std::vector<LineWithIDs> layersLines;
-    std::vector<double>      heights;
+    // Only the piles are collected here, the lines of each layer are generated by the worker thread testing the layer.
+    std::vector<LinesBucketPiles> layersPiles;
+    std::vector<double>           heights;
     while (conflictQueue.valid()) {
-        LineWithIDs lines     = conflictQueue.getCurLines();
-        double      curHeight = conflictQueue.removeLowests();
+        LinesBucketPiles piles     = conflictQueue.getCurPiles();
+        double           curHeight = conflictQueue.removeLowests();
         heights.push_back(curHeight);
-        layersLines.push_back(std::move(lines));
+        layersPiles.push_back(std::move(piles));
     }
 
-    bool                                   find = false;
-    tbb::concurrent_vector<std::tuple<ConflictComputeResult, double, int>> conflict;
-
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, layersLines.size()), [&](tbb::blocked_range<size_t> range) {
-        for (size_t i = range.begin(); i < range.end(); i++) {
-            auto interRes = find_inter_of_lines(layersLines[i]);
-            if (interRes.has_value()) {
-                find = true;
-                conflict.emplace_back(*interRes, heights[i], i);
+    // Heights grow with the layer index, the lowest conflicting layer is reported.
+    // Layers above the lowest conflict found so far are skipped.
+    std::atomic<size_t>             first_conflict_layer{layersPiles.size()};
+    std::vector<ConflictComputeOpt> layersConflicts(layersPiles.size());
+
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, layersPiles.size()), [&](tbb::blocked_range<size_t> range) {
+        for (size_t i = range.begin(); i < range.end() && i < first_conflict_layer; i++) {
+            layersConflicts[i] = find_inter_of_lines(LinesBucketQueue::getLines(layersPiles[i]));
+            if (layersConflicts[i].has_value()) {
+                size_t layer = first_conflict_layer;
+                while (i < layer && ! first_conflict_layer.compare_exchange_weak(layer, i));
                 break;
             }
         }
     });
 
-    if (find) {
-        std::sort(conflict.begin(), conflict.end(), [](const std::tuple<ConflictComputeResult, double, int>& i1, const std::tuple<ConflictComputeResult, double, int>& i2) {
-            return std::get<1>(i1) < std::get<1>(i2);
-        });
-
-        auto &[ccr, conflict_height, conflict_layer_id] = conflict[0];
+    if (size_t conflict_layer_id = first_conflict_layer; conflict_layer_id < layersPiles.size()) {
+        const ConflictComputeResult &ccr             = *layersConflicts[conflict_layer_id];
+        double                       conflict_height = heights[conflict_layer_id];
         const void *ptr1           = conflictQueue.idToObjsPtr(ccr._obj1);
         const void *ptr2           = conflictQueue.idToObjsPtr(ccr._obj2);
         if (ptr1 == &wtptr || ptr2 == &wtptr) {
@@ -372,11 +402,11 @@ ConflictResultOpt ConflictChecker::find_inter_of_lines_in_diff_objs(SpanOfConstP
             assert(ptr2 != &wtptr);
             if (ptr2 == &wtptr) { return {}; }
             const PrintObject *obj2 = reinterpret_cast<const PrintObject *>(ptr2);
-            return std::make_optional<ConflictResult>("WipeTower", obj2->model_object()->name, conflict_height, nullptr, ptr2, conflict_layer_id);
+            return std::make_optional<ConflictResult>("WipeTower", obj2->model_objects_names(), conflict_height, nullptr, ptr2, conflict_layer_id);
         }
         const PrintObject *obj1 = reinterpret_cast<const PrintObject *>(ptr1);
         const PrintObject *obj2 = reinterpret_cast<const PrintObject *>(ptr2);
-        return std::make_optional<ConflictResult>(obj1->model_object()->name, obj2->model_object()->name, conflict_height, ptr1, ptr2, conflict_layer_id);
+        return std::make_optional<ConflictResult>(obj1->model_objects_names(), obj2->model_objects_names(), conflict_height, ptr1, ptr2, conflict_layer_id);
     } else
         return {};
 }
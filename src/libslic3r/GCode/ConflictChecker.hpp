@@ -53,16 +53,18 @@ public:
         }
     }
     double      curHeight() const { return _curHeight; }
-    LineWithIDs curLines() const
+    unsigned    curPileIdx() const { return _curPileIdx; }
+    LineWithIDs curLines() const { return lines(_curPileIdx); }
+    // Lines of all instances of the given pile, the piles are not modified so it may be called from more threads.
+    LineWithIDs lines(unsigned pile_idx) const
     {
         LineWithIDs lines;
-        for (const ExtrusionPath &path : _piles[_curPileIdx]) {
-            Polyline check_polyline;
+        for (const ExtrusionPath &path : _piles[pile_idx]) {
+            const Polyline polyline = path.as_polyline().to_polyline();
             for (int idx_offset = 0; idx_offset < (int)_offsets.size(); ++idx_offset) {
-                check_polyline = path.as_polyline().to_polyline();
-                check_polyline.translate(_offsets[idx_offset]);
-                for (size_t idx_pt = 1; idx_pt < check_polyline.size(); ++idx_pt) {
-                    lines.emplace_back(Line(check_polyline.points[idx_pt - 1], check_polyline.points[idx_pt]), _id, idx_offset, path.role());
+                const Point &offset = _offsets[idx_offset];
+                for (size_t idx_pt = 1; idx_pt < polyline.size(); ++idx_pt) {
+                    lines.emplace_back(Line(polyline.points[idx_pt - 1] + offset, polyline.points[idx_pt] + offset), _id, idx_offset, path.role());
                 }
             }
         }
@@ -79,6 +81,9 @@ struct LinesBucketPtrComp
     bool operator()(const LinesBucket *left, const LinesBucket *right) { return *left > *right; }
 };
 
+// Current pile of each valid bucket, enough to generate the lines of one layer later.
+using LinesBucketPiles = std::vector<std::pair<const LinesBucket *, unsigned>>;
+
 class LinesBucketQueue
 {
 private:
@@ -99,7 +104,9 @@ public:
             return nullptr;
     }
     double      removeLowests();
-    LineWithIDs getCurLines() const;
+    LineWithIDs getCurLines() const { return getLines(getCurPiles()); }
+    LinesBucketPiles   getCurPiles() const;
+    static LineWithIDs getLines(const LinesBucketPiles &piles);
 };
 
 void getExtrusionPathsFromEntity(const ExtrusionEntityCollection *entity, ExtrusionPaths &paths);
@@ -126,6 +133,7 @@ using ConflictObjName = std::optional<std::pair<std::string, std::string>>;
 struct ConflictChecker
 {
     static ConflictResultOpt  find_inter_of_lines_in_diff_objs(SpanOfConstPtrs<PrintObject> objs, const WipeTowerData& wtd);
+    // Lines are hashed into a uniform grid, only lines of different instances sharing a grid cell are tested.
     static ConflictComputeOpt find_inter_of_lines(const LineWithIDs &lines);
     static ConflictComputeOpt line_intersect(const LineWithID &l1, const LineWithID &l2);
 };
@@ -11,6 +11,7 @@
 #include "libslic3r/GCode/GCodeWriter.hpp"
 #include "libslic3r/I18N.hpp"
 #include "libslic3r/Geometry/ArcWelder.hpp"
+#include "libslic3r/Thread.hpp"
 #include "GCodeProcessor.hpp"
 
 #include <boost/algorithm/string/case_conv.hpp>
@@ -30,6 +31,9 @@
 #endif
 
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 
 static const float DEFAULT_TOOLPATH_WIDTH = 0.4f;
 static const float DEFAULT_TOOLPATH_HEIGHT = 0.2f;
@@ -4358,6 +4362,110 @@ void GCodeProcessor::post_process()
 
 
     // Helper class to modify and export gcode to file
+    // Feeds the binarizer from a worker thread: the compression of the G-code blocks and the writing of the file
+    // run concurrently with the parsing of the temporary G-code and the insertion of the M73 lines.
+    // The binarizer must not be accessed by the caller between start() and finish().
+    class BinarizerWorker
+    {
+        // size of the chunks sent to the worker, to not lock the queue for each line
+        const size_t m_chunk_size{ 65536 };
+        // number of chunks waiting for the worker before the producer is blocked
+        const size_t m_max_queued_chunks{ 16 };
+
+        bgcode::binarize::Binarizer& m_binarizer;
+        std::string m_chunk;
+        std::deque<std::string> m_queue;
+        std::mutex m_mutex;
+        std::condition_variable m_cv_consumer;
+        std::condition_variable m_cv_producer;
+        bool m_finished{ false };
+        bool m_error{ false };
+        boost::thread m_thread;
+
+        void run() {
+            std::unique_lock<std::mutex> lck(m_mutex);
+            for (;;) {
+                m_cv_consumer.wait(lck, [this]() { return !m_queue.empty() || m_finished; });
+                if (m_queue.empty())
+                    return;
+                std::string gcode = std::move(m_queue.front());
+                m_queue.pop_front();
+                lck.unlock();
+                m_cv_producer.notify_one();
+                bool ok = false;
+                try {
+                    ok = m_binarizer.append_gcode(gcode) == bgcode::core::EResult::Success;
+                } catch (...) {
+                }
+                lck.lock();
+                if (!ok) {
+                    m_error = true;
+                    m_queue.clear();
+                    m_cv_producer.notify_one();
+                    return;
+                }
+            }
+        }
+
+        void push_chunk() {
+            {
+                std::unique_lock<std::mutex> lck(m_mutex);
+                m_cv_producer.wait(lck, [this]() { return m_queue.size() < m_max_queued_chunks || m_error; });
+                if (m_error)
+                    throw Slic3r::RuntimeError("Error while sending gcode to the binarizer.");
+                m_queue.emplace_back(std::move(m_chunk));
+            }
+            m_cv_consumer.notify_one();
+            m_chunk.clear();
+            m_chunk.reserve(m_chunk_size);
+        }
+
+        void stop() {
+            {
+                std::lock_guard<std::mutex> lck(m_mutex);
+                m_finished = true;
+            }
+            m_cv_consumer.notify_one();
+            if (m_thread.joinable())
+                m_thread.join();
+        }
+
+    public:
+        explicit BinarizerWorker(bgcode::binarize::Binarizer& binarizer) : m_binarizer(binarizer) {}
+        ~BinarizerWorker() {
+            // if finish() wasn't called, the export is aborted: don't bother with the remaining chunks.
+            {
+                std::lock_guard<std::mutex> lck(m_mutex);
+                m_queue.clear();
+            }
+            this->stop();
+        }
+
+        void start() {
+            m_chunk.reserve(m_chunk_size);
+            m_thread = create_thread([this]() { this->run(); });
+        }
+
+        void append(const std::string& gcode) {
+            m_chunk += gcode;
+            if (m_chunk.size() >= m_chunk_size)
+                this->push_chunk();
+        }
+
+        // Send the last chunk and wait for the worker to consume everything.
+        void finish() {
+            if (!m_chunk.empty())
+                this->push_chunk();
+            this->stop();
+            if (m_error)
+                throw Slic3r::RuntimeError("Error while sending gcode to the binarizer.");
+        }
+    };
+
+    BinarizerWorker binarizer_worker(m_binarizer);
+    if (m_binarizer.is_enabled())
+        binarizer_worker.start();
+
     class ExportLines
     {
     public:
@@ -4426,13 +4534,14 @@ void GCodeProcessor::post_process()
         size_t m_out_file_pos{ 0 };
 
         bgcode::binarize::Binarizer& m_binarizer;
+        BinarizerWorker& m_binarizer_worker;
 
     public:
-        ExportLines(bgcode::binarize::Binarizer& binarizer, EWriteType type, TimeMachine& machine)
+        ExportLines(bgcode::binarize::Binarizer& binarizer, BinarizerWorker& binarizer_worker, EWriteType type, TimeMachine& machine)
 #ifndef NDEBUG
-        : m_statistics(*this), m_binarizer(binarizer), m_write_type(type), m_machine(machine) {}
+        : m_statistics(*this), m_binarizer(binarizer), m_binarizer_worker(binarizer_worker), m_write_type(type), m_machine(machine) {}
 #else
-        : m_binarizer(binarizer), m_write_type(type), m_machine(machine) {}
+        : m_binarizer(binarizer), m_binarizer_worker(binarizer_worker), m_write_type(type), m_machine(machine) {}
 #endif // NDEBUG
 
         // return: number of internal G1 lines (from G2/G3 splitting) processed
@@ -4570,8 +4679,7 @@ void GCodeProcessor::post_process()
             }
 
             if (m_binarizer.is_enabled()) {
-                if (m_binarizer.append_gcode(out_string) != bgcode::core::EResult::Success)
-                    throw Slic3r::RuntimeError("Error while sending gcode to the binarizer.");
+                m_binarizer_worker.append(out_string);
             }
             else {
                 write_to_file(out, out_string, result, out_path);
@@ -4593,8 +4701,7 @@ void GCodeProcessor::post_process()
 #endif // NDEBUG
 
             if (m_binarizer.is_enabled()) {
-                if (m_binarizer.append_gcode(out_string) != bgcode::core::EResult::Success)
-                    throw Slic3r::RuntimeError("Error while sending gcode to the binarizer.");
+                m_binarizer_worker.append(out_string);
             }
             else {
                 write_to_file(out, out_string, result, out_path);
@@ -4630,7 +4737,7 @@ void GCodeProcessor::post_process()
         }
     };
 
-    ExportLines export_lines(m_binarizer, m_result.backtrace_enabled ? ExportLines::EWriteType::ByTime : ExportLines::EWriteType::BySize, m_time_processor.machines[0]);
+    ExportLines export_lines(m_binarizer, binarizer_worker, m_result.backtrace_enabled ? ExportLines::EWriteType::ByTime : ExportLines::EWriteType::BySize, m_time_processor.machines[0]);
 
     // replace placeholder lines with the proper final value
     // gcode_line is in/out parameter, to reduce expensive memory allocation
@@ -4940,6 +5047,7 @@ void GCodeProcessor::post_process()
     export_lines.flush(out, m_result, out_path);
 
     if (m_binarizer.is_enabled()) {
+        binarizer_worker.finish();
         if (m_binarizer.finalize() != bgcode::core::EResult::Success)
             throw Slic3r::RuntimeError("Error while finalizing the gcode binarizer.");
     }
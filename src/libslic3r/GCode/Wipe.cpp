@@ -67,9 +67,9 @@ void Wipe::set_path(const ExtrusionPaths &paths, bool reversed, bool is_loop)
                 if (m_path.back().point != it->last_point())
                     // ExtrusionMultiPath is interrupted in some place. This should not really happen.
                     break;
-                ArcPolyline polyline = it->as_polyline();
-                len += Geometry::ArcWelder::estimate_path_length(polyline.get_arc());
-                m_path.insert(m_path.end(), polyline.get_arc().rbegin() + 1, polyline.get_arc().rend());
+                const Geometry::ArcWelder::Path arc_path = it->as_polyline().get_arc();
+                len += Geometry::ArcWelder::estimate_path_length(arc_path);
+                m_path.insert(m_path.end(), arc_path.rbegin() + 1, arc_path.rend());
             }
         } else {
             m_path = std::move(paths.front().as_polyline().get_arc());
@@ -82,9 +82,9 @@ void Wipe::set_path(const ExtrusionPaths &paths, bool reversed, bool is_loop)
                 if (m_path.back().point != it->first_point())
                     // ExtrusionMultiPath is interrupted in some place. This should not really happen.
                     break;
-                ArcPolyline polyline = it->as_polyline();
-                len += Geometry::ArcWelder::estimate_path_length(polyline.get_arc());
-                m_path.insert(m_path.end(), polyline.get_arc().begin() + 1, polyline.get_arc().end());
+                const Geometry::ArcWelder::Path arc_path = it->as_polyline().get_arc();
+                len += Geometry::ArcWelder::estimate_path_length(arc_path);
+                m_path.insert(m_path.end(), arc_path.begin() + 1, arc_path.end());
             }
         }
     }
@@ -525,8 +525,8 @@ std::string Wipe::wipe(GCodeGenerator &gcodegen, bool toolchange)
 bool longer_than(const ExtrusionPaths &paths, double length)
 {
     for (const ExtrusionPath &path : paths) {
-        ArcPolyline polyline = path.as_polyline();
-        for (auto it = std::next(polyline.get_arc().begin()); it != polyline.get_arc().end(); ++it) {
+        const Geometry::ArcWelder::Path arc_path = path.as_polyline().get_arc();
+        for (auto it = std::next(arc_path.begin()); it != arc_path.end(); ++it) {
             length -= Geometry::ArcWelder::segment_length<double>(*std::prev(it), *it);
             if (length < 0)
                 return true;
@@ -543,9 +543,9 @@ std::optional<Point> sample_path_point_at_distance_from_start(const ExtrusionPat
 {
     if (distance >= 0) {
         for (const ExtrusionPath &path : paths) {
-            ArcPolyline polyline = path.as_polyline();
-            auto it  = polyline.get_arc().begin();
-            auto end = polyline.get_arc().end();
+            const Geometry::ArcWelder::Path arc_path = path.as_polyline().get_arc();
+            auto it  = arc_path.begin();
+            auto end = arc_path.end();
             Point prev_point = it->point;
             for (++ it; it != end; ++ it) {
                 Point point = it->point;
@@ -581,9 +581,9 @@ std::optional<Point> sample_path_point_at_distance_from_end(const ExtrusionPaths
 {
     if (distance >= 0) {
         for (const ExtrusionPath& path : paths) {
-            ArcPolyline polyline = path.as_polyline();
-            auto it = polyline.get_arc().begin();
-            auto end = polyline.get_arc().end();
+            const Geometry::ArcWelder::Path arc_path = path.as_polyline().get_arc();
+            auto it = arc_path.begin();
+            auto end = arc_path.end();
             Point prev_point = it->point;
             for (++it; it != end; ++it) {
                 Point point = it->point;
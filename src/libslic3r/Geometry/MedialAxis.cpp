@@ -10,6 +10,7 @@
 #include "clipper.hpp"
 #include "../ClipperUtils.hpp"
 #include "ClipperUtils.hpp"
+#include "../Thread.hpp"
 
 #include <boost/log/trivial.hpp>
 
@@ -44,7 +45,10 @@ MedialAxis::polyline_from_voronoi(const ExPolygon& voronoi_polygon, ThickPolylin
 {
     std::map<const VD::edge_type*, std::pair<coordf_t, coordf_t> > thickness;
     Lines lines = voronoi_polygon.lines();
-    VD vd;
+    // Scratch diagram, reused by all the medial axes computed on this thread to keep the allocated cells, edges & vertices.
+    // polyline_from_voronoi() isn't reentrant, and nothing from the diagram escapes this function.
+    static thread_local VD vd;
+    vd.clear();
     ExPolygons poly_temp;
     const ExPolygon* poly_to_use = &voronoi_polygon;
     vd.construct_voronoi(lines.begin(), lines.end());
@@ -2771,6 +2775,26 @@ unsafe_variable_width(const ThickPolyline& polyline, const ExtrusionRole role, c
     return paths;
 }
 
+void build_medial_axes(size_t count, const std::function<void(size_t, ThickPolylines&)>& build_one, ThickPolylines& polylines_out)
+{
+    if (count == 0)
+        return;
+    if (count == 1) {
+        build_one(0, polylines_out);
+        return;
+    }
+    std::vector<ThickPolylines> results(count);
+    Slic3r::parallel_for(size_t(0), count, [&build_one, &results](size_t idx) {
+        build_one(idx, results[idx]);
+    });
+    size_t nb_polylines = polylines_out.size();
+    for (const ThickPolylines& result : results)
+        nb_polylines += result.size();
+    polylines_out.reserve(nb_polylines);
+    for (ThickPolylines& result : results)
+        std::move(result.begin(), result.end(), std::back_inserter(polylines_out));
+}
+
 ExtrusionEntitiesPtr
     thin_variable_width(const ThickPolylines& polylines, const ExtrusionRole role, const Flow& flow, 
     const coord_t resolution_internal, bool can_reverse)
@@ -13,6 +13,7 @@
 #include "../ExtrusionEntityCollection.hpp"
 #include "../Flow.hpp"
 
+#include <functional>
 #include <vector>
 
 using boost::polygon::voronoi_builder;
@@ -175,6 +176,10 @@ private:
     void remove_bits(ThickPolylines& pp);
 };
 
+/// Run build_one(idx, polylines) for each idx in [0, count) in parallel (each call builds one MedialAxis) and append the results into polylines_out, in idx order.
+/// The inputs of the MedialAxis (expolygon & bounds) have to be kept alive by the caller until it returns.
+void build_medial_axes(size_t count, const std::function<void(size_t, ThickPolylines&)>& build_one, ThickPolylines& polylines_out);
+
 /// create a ExtrusionEntitiesPtr from ThickPolylines, discretizing the variable width into little sections (of 4*SCALED_RESOLUTION length) where needed. Please delete all ptr if not used.
 ExtrusionEntitiesPtr thin_variable_width(const ThickPolylines& polylines, const ExtrusionRole role, const Flow &flow, const coord_t resolution_internal, bool can_reverse);
 // used by thin_variable_width. Only does the work for a single polyline.
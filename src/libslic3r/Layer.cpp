@@ -613,6 +613,28 @@ void Layer::restore_untyped_slices_no_extra_perimeters()
 //    }
 }
 
+void Layer::compress_slices()
+{
+    if (m_slices_compressed)
+        return;
+    m_lslices_stored.assign(m_lslices);
+    ExPolygons().swap(m_lslices);
+    for (LayerRegion *layerm : m_regions)
+        layerm->compress_slices();
+    m_slices_compressed = true;
+}
+
+void Layer::decompress_slices()
+{
+    if (! m_slices_compressed)
+        return;
+    m_lslices = m_lslices_stored.decompress();
+    m_lslices_stored.clear();
+    for (LayerRegion *layerm : m_regions)
+        layerm->decompress_slices();
+    m_slices_compressed = false;
+}
+
 ExPolygons Layer::merged(coordf_t offset_scaled) const
 {
     assert(offset_scaled >= 0.f);
@@ -638,7 +660,7 @@ ExPolygons Layer::merged(coordf_t offset_scaled) const
 // Here the perimeters are created cummulatively for all layer regions sharing the same parameters influencing the perimeters.
 // The perimeter paths and the thin fills (ExtrusionEntityCollection) are assigned to the first compatible layer region.
 // The resulting fill surface is split back among the originating regions.
-void Layer::make_perimeters()
+void Layer::make_perimeters(PerimeterGenerator::Cache *perimeter_cache)
 {
     BOOST_LOG_TRIVIAL(trace) << "Generating perimeters for layer " << this->id();
     
@@ -773,7 +795,7 @@ void Layer::make_perimeters()
                     }
 
                 if (layer_region_ids.size() == 1) {  // optimization
-                    (*layerm)->make_perimeters((*layerm)->slices(), perimeter_and_gapfill_ranges, fill_expolygons, fill_expolygons_ranges);
+                    (*layerm)->make_perimeters((*layerm)->slices(), perimeter_and_gapfill_ranges, fill_expolygons, fill_expolygons_ranges, perimeter_cache);
                     this->sort_perimeters_into_islands((*layerm)->slices(), region_id, perimeter_and_gapfill_ranges, std::move(fill_expolygons), fill_expolygons_ranges, layer_region_ids);
                 } else {
                     SurfaceCollection new_slices;
@@ -810,7 +832,7 @@ void Layer::make_perimeters()
                     // make perimeters
                     assert(fill_expolygons_ranges.empty()); // merill test
                     this->m_object->print()->throw_if_canceled();
-                    layerm_config->make_perimeters(new_slices, perimeter_and_gapfill_ranges, fill_expolygons, fill_expolygons_ranges);
+                    layerm_config->make_perimeters(new_slices, perimeter_and_gapfill_ranges, fill_expolygons, fill_expolygons_ranges, perimeter_cache);
 
                     //// TODO: review if it's not useless or creates bugs.
                     //// assign fill_expolygons to each LayerRegion
@@ -17,6 +17,7 @@
 #include "Flow.hpp"
 #include "SurfaceCollection.hpp"
 #include "ExtrusionEntityCollection.hpp"
+#include "CompressedExPolygons.hpp"
 
 #include <boost/container/small_vector.hpp>
 
@@ -39,6 +40,10 @@ namespace FillLightning {
     class Generator;
 };
 
+namespace PerimeterGenerator {
+    class Cache;
+};
+
 // Range of indices, providing support for range based loops.
 template<typename T>
 class IndexRange
@@ -110,20 +115,29 @@ public:
 
     // collection of surfaces generated by slicing the original geometry
     // divided by type top/bottom/internal
-    [[nodiscard]] const SurfaceCollection&          slices() const { return m_slices; }
+    [[nodiscard]] const SurfaceCollection&          slices() const { this->throw_if_slices_compressed(); return m_slices; }
 
     // Unspecified fill polygons, used for overhang detection ("ensure vertical wall thickness feature")
     // and for re-starting of infills.
-    [[nodiscard]] const ExPolygons&                 fill_expolygons() const { return m_fill_expolygons; }
+    [[nodiscard]] const ExPolygons&                 fill_expolygons() const { this->throw_if_fill_expolygons_compressed(); return m_fill_expolygons; }
     // and their bounding boxes
     [[nodiscard]] const BoundingBoxes&              fill_expolygons_bboxes() const { return m_fill_expolygons_bboxes; }
     // Storage for fill regions produced for a single LayerIsland, of which infill splits into multiple islands.
     // Not used for a plain single material print with no infill modifiers.
-    [[nodiscard]] const ExPolygons&                 fill_expolygons_composite() const { return m_fill_expolygons_composite; }
+    [[nodiscard]] const ExPolygons&                 fill_expolygons_composite() const { this->throw_if_fill_expolygons_compressed(); return m_fill_expolygons_composite; }
     // and their bounding boxes
     [[nodiscard]] const BoundingBoxes&              fill_expolygons_composite_bboxes() const { return m_fill_expolygons_composite_bboxes; }
 
-    [[nodiscard]] const ExPolygons&                 fill_no_overlap_expolygons() const { return m_fill_no_overlap_expolygons; }
+    [[nodiscard]] const ExPolygons&                 fill_no_overlap_expolygons() const { this->throw_if_fill_expolygons_compressed(); return m_fill_no_overlap_expolygons; }
+    // The fill expolygons are only read again if the infill or the ironing is regenerated: they may be compressed once
+    // the ironing is done. They have to be decompressed before being accessed, the accessors throw otherwise.
+    void                                            compress_fill_expolygons();
+    void                                            decompress_fill_expolygons();
+    [[nodiscard]] bool                              fill_expolygons_compressed() const { return m_fill_expolygons_compressed; }
+    // The slices and the cached raw slices are read until the G-code is exported: they may be compressed after the export.
+    void                                            compress_slices();
+    void                                            decompress_slices();
+    [[nodiscard]] bool                              slices_compressed() const { return m_slices_compressed; }
 
     // collection of surfaces generated by slicing the original geometry
     // divided by type top/bottom/internal
@@ -172,7 +186,9 @@ public:
         // All fill areas produced for all input slices above.
         ExPolygons                                             &fill_expolygons,
         // Ranges of fill areas above per input slice.
-        std::vector<ExPolygonRange>                            &fill_expolygons_ranges);
+        std::vector<ExPolygonRange>                            &fill_expolygons_ranges,
+        // Perimeters shared by the layers of the object, may be null.
+        PerimeterGenerator::Cache                              *perimeter_cache = nullptr);
     void    make_milling_post_process(const SurfaceCollection& slices);
     void    process_external_surfaces(const Layer *lower_layer, const Polygons *lower_layer_covered);
     void    process_external_surfaces_old(const Layer *lower_layer, const Polygons *lower_layer_covered);
@@ -195,7 +211,7 @@ public:
 
     void    simplify_extrusion_entity();
 
-    const ExPolygons &get_cached_slices() const { return m_raw_slices; }
+    const ExPolygons &get_cached_slices() const { this->throw_if_slices_compressed(); return m_raw_slices; }
 
 protected:
     friend class Layer;
@@ -215,6 +231,11 @@ private:
     template<typename ThrowOnCancel>
     friend void apply_mm_segmentation(PrintObject& print_object, ThrowOnCancel throw_on_cancel);
 
+    void throw_if_fill_expolygons_compressed() const
+        { if (m_fill_expolygons_compressed) throw Slic3r::RuntimeError("LayerRegion: the fill expolygons are compressed"); }
+    void throw_if_slices_compressed() const
+        { if (m_slices_compressed) throw Slic3r::RuntimeError("LayerRegion: the slices are compressed"); }
+
     Layer                      *m_layer;
     const PrintRegion          *m_region;
 
@@ -244,6 +265,16 @@ private:
     // Unspecified fill polygons, used for intersecting when we don't want the infill/perimeter overlap
     // note: if empty, that means there is no overlap, so you don't need to intersect with it.
     ExPolygons                  m_fill_no_overlap_expolygons;
+    // Storage of m_fill_expolygons, m_fill_expolygons_composite and m_fill_no_overlap_expolygons while compressed.
+    CompressedExPolygons        m_fill_expolygons_stored;
+    CompressedExPolygons        m_fill_expolygons_composite_stored;
+    CompressedExPolygons        m_fill_no_overlap_expolygons_stored;
+    bool                        m_fill_expolygons_compressed { false };
+    // Storage of the expolygons of m_slices and of m_raw_slices while compressed.
+    // The surfaces of m_slices are kept with empty expolygons, to keep their types and attributes.
+    CompressedExPolygons        m_slices_stored;
+    CompressedExPolygons        m_raw_slices_stored;
+    bool                        m_slices_compressed { false };
 
     // Collection of surfaces for infill generation, created by splitting m_slices by m_fill_expolygons.
     SurfaceCollection           m_fill_surfaces;
@@ -392,8 +423,8 @@ public:
 protected:
     ExPolygons 				m_lslices;
 public:
-    const ExPolygons &      lslices() const { return m_lslices; }
-    ExPolygons &            set_lslices() { return m_lslices; }
+    const ExPolygons &      lslices() const { this->throw_if_slices_compressed(); return m_lslices; }
+    ExPolygons &            set_lslices() { this->throw_if_slices_compressed(); return m_lslices; }
     std::vector<size_t>     lslice_indices_sorted_by_print_order;
     LayerSlices             lslices_ex;
 
@@ -415,7 +446,7 @@ public:
     void                    restore_untyped_slices_no_extra_perimeters();
     // Slices merged into islands, to be used by the elephant foot compensation to trim the individual surfaces with the shrunk merged slices.
     ExPolygons              merged(coordf_t offset_scaled = 0) const;
-    void                    make_perimeters();
+    void                    make_perimeters(PerimeterGenerator::Cache *perimeter_cache = nullptr);
     void                    make_milling_post_process();
     void                    make_fills(FillAdaptive::Octree     *adaptive_fill_octree,
                                        FillAdaptive::Octree     *support_fill_octree,
@@ -436,6 +467,12 @@ public:
 //    virtual bool            has_extrusions() const { for (const LayerSlice &lslice : lslices_ex) if (lslice.has_extrusions()) return true; return false; }
 
     void simplify_extrusion_path() { for (auto layerm : m_regions) layerm->simplify_extrusion_entity(); }
+
+    // Compress the lslices and the slices of the regions once the G-code is exported, to lower the memory
+    // held by a finished layer. They have to be decompressed before being accessed, the accessors throw otherwise.
+    void                    compress_slices();
+    void                    decompress_slices();
+    bool                    slices_compressed() const { return m_slices_compressed; }
 protected:
     friend class PrintObject;
     friend std::vector<Layer*> new_layers(PrintObject*, const std::vector<coordf_t>&);
@@ -467,10 +504,16 @@ private:
         // If the current layer consists of multiple regions, then the fill_expolygons above are split by the source LayerRegion surfaces.
         const std::vector<uint32_t>                                     &layer_region_ids);
 
+    void throw_if_slices_compressed() const
+        { if (m_slices_compressed) throw Slic3r::RuntimeError("Layer: the slices are compressed"); }
+
     // Sequential index of layer, 0-based, offsetted by number of raft layers.
     size_t              m_id;
     PrintObject        *m_object;
     LayerRegionPtrs     m_regions;
+    // Storage of m_lslices while compressed.
+    CompressedExPolygons m_lslices_stored;
+    bool                m_slices_compressed { false };
 };
 
 class SupportLayer : public Layer 
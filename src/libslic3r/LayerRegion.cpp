@@ -16,6 +16,7 @@
 #include "BoundingBox.hpp"
 #include "SVG.hpp"
 #include "Algorithm/RegionExpansion.hpp"
+#include "Thread.hpp"
 
 #include <algorithm>
 #include <string>
@@ -38,6 +39,67 @@ void LayerRegion::clear() {
     this->m_fill_expolygons_composite.clear();
     this->m_fill_expolygons_composite_bboxes.clear();
     this->m_fill_no_overlap_expolygons.clear();
+    this->m_fill_expolygons_stored.clear();
+    this->m_fill_expolygons_composite_stored.clear();
+    this->m_fill_no_overlap_expolygons_stored.clear();
+    this->m_fill_expolygons_compressed = false;
+}
+
+void LayerRegion::compress_fill_expolygons()
+{
+    if (m_fill_expolygons_compressed)
+        return;
+    m_fill_expolygons_stored.assign(m_fill_expolygons);
+    m_fill_expolygons_composite_stored.assign(m_fill_expolygons_composite);
+    m_fill_no_overlap_expolygons_stored.assign(m_fill_no_overlap_expolygons);
+    // Release the memory, clear() would keep the capacity.
+    ExPolygons().swap(m_fill_expolygons);
+    ExPolygons().swap(m_fill_expolygons_composite);
+    ExPolygons().swap(m_fill_no_overlap_expolygons);
+    m_fill_expolygons_compressed = true;
+}
+
+void LayerRegion::decompress_fill_expolygons()
+{
+    if (! m_fill_expolygons_compressed)
+        return;
+    m_fill_expolygons            = m_fill_expolygons_stored.decompress();
+    m_fill_expolygons_composite  = m_fill_expolygons_composite_stored.decompress();
+    m_fill_no_overlap_expolygons = m_fill_no_overlap_expolygons_stored.decompress();
+    m_fill_expolygons_stored.clear();
+    m_fill_expolygons_composite_stored.clear();
+    m_fill_no_overlap_expolygons_stored.clear();
+    m_fill_expolygons_compressed = false;
+}
+
+void LayerRegion::compress_slices()
+{
+    if (m_slices_compressed)
+        return;
+    ExPolygons expolygons;
+    expolygons.reserve(m_slices.surfaces.size());
+    for (Surface &surface : m_slices.surfaces) {
+        expolygons.emplace_back(std::move(surface.expolygon));
+        surface.expolygon = ExPolygon();
+    }
+    m_slices_stored.assign(expolygons);
+    m_raw_slices_stored.assign(m_raw_slices);
+    ExPolygons().swap(m_raw_slices);
+    m_slices_compressed = true;
+}
+
+void LayerRegion::decompress_slices()
+{
+    if (! m_slices_compressed)
+        return;
+    ExPolygons expolygons = m_slices_stored.decompress();
+    assert(expolygons.size() == m_slices.surfaces.size());
+    for (size_t i = 0; i < m_slices.surfaces.size(); ++ i)
+        m_slices.surfaces[i].expolygon = std::move(expolygons[i]);
+    m_raw_slices = m_raw_slices_stored.decompress();
+    m_slices_stored.clear();
+    m_raw_slices_stored.clear();
+    m_slices_compressed = false;
 }
 
 Flow LayerRegion::flow(FlowRole role) const
@@ -125,7 +187,9 @@ void LayerRegion::make_perimeters(
     // All fill areas produced for all input slices above.
     ExPolygons                                             &fill_expolygons,
     // Ranges of fill areas above per input slice.
-    std::vector<ExPolygonRange>                            &fill_expolygons_ranges)
+    std::vector<ExPolygonRange>                            &fill_expolygons_ranges,
+    // Perimeters shared by the layers of the object, may be null.
+    PerimeterGenerator::Cache                              *perimeter_cache)
 {
     m_perimeters.clear();
     m_thin_fills.clear();
@@ -156,6 +220,8 @@ void LayerRegion::make_perimeters(
         spiral_vase,
         (region_config.perimeter_generator.value == PerimeterGeneratorType::Arachne) //use_arachne
     );
+    if (perimeter_cache != nullptr)
+        params.arachne_cache = &perimeter_cache->arachne;
     
 
     // perimeter bonding set.
@@ -170,11 +236,24 @@ void LayerRegion::make_perimeters(
     const ExPolygons *lower_slices = this->layer()->lower_layer ? &this->layer()->lower_layer->lslices() : nullptr;
     const ExPolygons *upper_slices = this->layer()->upper_layer ? &this->layer()->upper_layer->lslices() : nullptr;
     
-    for (const Surface &surface : slices) {
-        size_t perimeters_begin = m_perimeters.size();
-        size_t gap_fills_begin = m_thin_fills.size();
-        size_t fill_expolygons_begin = fill_expolygons.size();
-
+    // Islands are independent, generate their perimeters in parallel (a large flat layer may be made of many islands),
+    // then append the results in the order of the input slices.
+    // Fuzzy skin is random and milling depends on z, their islands are never taken from the cache.
+    const bool use_cache = perimeter_cache != nullptr && region_config.fuzzy_skin.value == FuzzySkinType::None && ! region_config.milling_post_process.value;
+    const uint32_t layer_flags = use_cache ? PerimeterGenerator::Cache::layer_flags(params) : 0;
+    const size_t lower_slices_hash = use_cache ? PerimeterGenerator::Cache::hash(lower_slices) : 0;
+    const size_t upper_slices_hash = use_cache ? PerimeterGenerator::Cache::hash(upper_slices) : 0;
+    std::vector<PerimeterGenerator::Cache::Result> islands(slices.size());
+    auto make_island_perimeters = [this, &params, &slices, &islands, lower_slices, upper_slices, perimeter_cache, use_cache, layer_flags, lower_slices_hash, upper_slices_hash](size_t surface_idx) {
+        PerimeterGenerator::Cache::Result &island  = islands[surface_idx];
+        const Surface                     &surface = slices.surfaces[surface_idx];
+        PerimeterGenerator::Cache::Query   query;
+        if (use_cache) {
+            query = { &this->region(), this->layer()->height, layer_flags, &surface, lower_slices, upper_slices,
+                      PerimeterGenerator::Cache::hash(&this->region(), this->layer()->height, layer_flags, surface, lower_slices_hash, upper_slices_hash) };
+            if (perimeter_cache->find(query, island))
+                return;
+        }
         PerimeterGenerator::PerimeterGenerator g{params};
         g.throw_if_canceled = [this]() { this->layer()->object()->print()->throw_if_canceled(); };
         g.process(
@@ -182,14 +261,31 @@ void LayerRegion::make_perimeters(
             surface, lower_slices, slices, upper_slices,
             // output:
                 // Loops with the external thin walls
-            &m_perimeters,
+            &island.loops,
                 // Gaps without the thin walls
-            &m_thin_fills,
+            &island.gap_fill,
                 // Infills without the gap fills
-            fill_expolygons,
+            island.fill_expolygons,
                 // mask for "no overlap" area
-            m_fill_no_overlap_expolygons
+            island.fill_no_overlap
         );
+        if (use_cache)
+            perimeter_cache->insert(query, island);
+    };
+    if (slices.size() > 1)
+        Slic3r::parallel_for(size_t(0), slices.size(), make_island_perimeters);
+    else if (slices.size() == 1)
+        make_island_perimeters(0);
+
+    for (PerimeterGenerator::Cache::Result &island : islands) {
+        size_t perimeters_begin = m_perimeters.size();
+        size_t gap_fills_begin = m_thin_fills.size();
+        size_t fill_expolygons_begin = fill_expolygons.size();
+
+        m_perimeters.append_move_from(island.loops);
+        m_thin_fills.append_move_from(island.gap_fill);
+        append(fill_expolygons, std::move(island.fill_expolygons));
+        append(m_fill_no_overlap_expolygons, std::move(island.fill_no_overlap));
 
         for(auto *peri : this->m_perimeters.entities()) assert(!peri->empty());
 
@@ -13,6 +13,7 @@
 #undef L
 
 // CGAL headers
+#include <CGAL/Polygon_mesh_processing/bbox.h>
 #include <CGAL/Polygon_mesh_processing/corefinement.h>
 #include <CGAL/Exact_integer.h>
 #include <CGAL/Surface_mesh.h>
@@ -324,6 +325,22 @@ CGALMeshPtr clone(const CGALMesh &m)
     return CGALMeshPtr{new CGALMesh{m}};
 }
 
+BoundingBoxf3 bounding_box(const CGALMesh &mesh)
+{
+    BoundingBoxf3 bb;
+    if (mesh.m.is_empty())
+        return bb;
+    CGAL::Bbox_3 cgalbb = CGALProc::bbox(mesh.m);
+    bb.merge(Vec3d{cgalbb.xmin(), cgalbb.ymin(), cgalbb.zmin()});
+    bb.merge(Vec3d{cgalbb.xmax(), cgalbb.ymax(), cgalbb.zmax()});
+    return bb;
+}
+
+void merge(CGALMesh &A, const CGALMesh &B)
+{
+    A.m += B.m;
+}
+
 } // namespace cgal
 
 } // namespace MeshBoolean
@@ -69,6 +69,10 @@ bool does_self_intersect(const CGALMesh &mesh);
 bool does_bound_a_volume(const CGALMesh &mesh);
 bool empty(const CGALMesh &mesh);
 
+BoundingBoxf3 bounding_box(const CGALMesh &mesh);
+// Append the triangles of B into A without any boolean operation. The union of two meshes with disjoint bounding boxes.
+void merge(CGALMesh &A, const CGALMesh &B);
+
 }
 
 } // namespace MeshBoolean
@@ -19,6 +19,9 @@
 #include <openvdb/tools/Composite.h>
 #include <openvdb/tools/LevelSetRebuild.h>
 #include <openvdb/tools/FastSweeping.h>
+#include <openvdb/tools/Clip.h>
+
+#include "Execution/ExecutionTBB.hpp"
 
 namespace Slic3r {
 
@@ -308,4 +311,74 @@ bool is_grid_empty(const VoxelGrid &grid)
     return grid.grid.empty();
 }
 
+VoxelGridPtr process_grid_in_slabs(const VoxelGrid &vgrid,
+                                   float            halo,
+                                   size_t           max_slabs,
+                                   const std::function<VoxelGridPtr(const VoxelGrid &)> &fn)
+{
+    const openvdb::FloatGrid &grid = vgrid.grid;
+    openvdb::CoordBBox        bb   = grid.evalActiveVoxelBoundingBox();
+    openvdb::Coord            dim  = bb.dim();
+
+    // Slabs are cut across the longest axis.
+    int axis = 0;
+    for (int i = 1; i < 3; ++i)
+        if (dim[i] > dim[axis])
+            axis = i;
+
+    // One more voxel for the trilinear interpolation at the slab border.
+    int halo_vx = int(std::ceil(halo / grid.voxelSize()[axis])) + 1;
+
+    if (max_slabs == 0)
+        max_slabs = execution::max_concurrency(ex_tbb);
+
+    size_t slabs = bb.empty() ? 0 : std::min(max_slabs, size_t(dim[axis] / (2 * halo_vx)));
+    if (slabs < 2)
+        return fn(vgrid);
+
+    auto slab_start = [&bb, &dim, axis, slabs](size_t i) {
+        return bb.min()[axis] + int(int64_t(dim[axis]) * int64_t(i) / int64_t(slabs));
+    };
+
+    std::vector<VoxelGridPtr> results(slabs);
+    execution::for_each(ex_tbb, size_t(0), slabs, [&](size_t i) {
+        // Input of the slab including the halo.
+        openvdb::CoordBBox inbox = bb;
+        inbox.expand(halo_vx);
+        inbox.min()[axis] = slab_start(i) - halo_vx;
+        inbox.max()[axis] = slab_start(i + 1) - 1 + halo_vx;
+
+        openvdb::FloatGrid::Ptr clipped = openvdb::tools::clip(grid, grid.transform().indexToWorld(inbox));
+        VoxelGridPtr slab = make_voxelgrid(std::move(*clipped));
+        // Copies voxel_scale metadata, if it exists.
+        slab->grid.insertMeta(*grid.deepCopyMeta());
+
+        VoxelGridPtr out = fn(*slab);
+        if (!out)
+            return;
+
+        // The outer slabs are open towards infinity as fn may grow the grid.
+        openvdb::CoordBBox core = openvdb::CoordBBox::inf();
+        if (i > 0)
+            core.min()[axis] = slab_start(i);
+        if (i + 1 < slabs)
+            core.max()[axis] = slab_start(i + 1) - 1;
+        out->grid.clip(core);
+
+        results[i] = std::move(out);
+    });
+
+    for (const VoxelGridPtr &r : results)
+        if (!r)
+            return {};
+
+    // The slabs don't overlap after the clipping and the clipped out parts of
+    // a slab are set to the (positive) background, the union stitches them.
+    VoxelGridPtr ret = std::move(results.front());
+    for (size_t i = 1; i < slabs; ++i)
+        openvdb::tools::csgUnion(ret->grid, results[i]->grid);
+
+    return ret;
+}
+
 } // namespace Slic3r
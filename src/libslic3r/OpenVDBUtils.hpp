@@ -5,6 +5,8 @@
 #ifndef OPENVDBUTILS_HPP
 #define OPENVDBUTILS_HPP
 
+#include <functional>
+
 #include <libslic3r/TriangleMesh.hpp>
 
 namespace Slic3r {
@@ -83,6 +85,17 @@ void grid_intersection(VoxelGrid &grid, VoxelGrid &arg);
 
 bool is_grid_empty(const VoxelGrid &grid);
 
+// Apply fn to slabs of the grid in parallel and stitch the results back into
+// a single grid. Each slab is extended by halo (world units) on both sides, fn
+// must not depend on the grid further than halo from a voxel. A grid too small
+// to be cut into slabs thicker than two halos is passed to fn whole, as is any
+// grid with max_slabs == 1. max_slabs == 0 means the available concurrency.
+// Returns nullptr if fn returns nullptr for any of the slabs.
+VoxelGridPtr process_grid_in_slabs(const VoxelGrid &grid,
+                                   float            halo,
+                                   size_t           max_slabs,
+                                   const std::function<VoxelGridPtr(const VoxelGrid &)> &fn);
+
 } // namespace Slic3r
 
 #endif // OPENVDBUTILS_HPP
@@ -53,6 +53,7 @@
 #include <vector>
 
 #include <ankerl/unordered_dense.h>
+#include <boost/functional/hash.hpp>
 #include <boost/log/trivial.hpp>
 
 //#define ARACHNE_DEBUG
@@ -65,6 +66,105 @@
 
 namespace Slic3r::PerimeterGenerator {
 
+uint32_t Cache::layer_flags(const Parameters &params)
+{
+    const size_t layer_id = params.layer->id();
+    return (layer_id % 2 == 1 ? 1u : 0u) |
+           (layer_id == 0 ? 2u : 0u) |
+           (layer_id > size_t(params.object_config.raft_layers.value) ? 4u : 0u) |
+           (layer_id >= size_t(params.config.bottom_solid_layers.value) ? 8u : 0u) |
+           (params.spiral_vase ? 16u : 0u);
+}
+
+static void hash_expolygon(size_t &seed, const ExPolygon &expolygon)
+{
+    boost::hash_combine(seed, expolygon.holes.size());
+    for (size_t idx = 0; idx <= expolygon.holes.size(); ++ idx) {
+        const Polygon &polygon = idx == 0 ? expolygon.contour : expolygon.holes[idx - 1];
+        boost::hash_combine(seed, polygon.size());
+        for (const Point &pt : polygon.points) {
+            boost::hash_combine(seed, pt.x());
+            boost::hash_combine(seed, pt.y());
+        }
+    }
+}
+
+size_t Cache::hash(const ExPolygons *expolygons)
+{
+    size_t seed = expolygons == nullptr ? 1 : 0;
+    if (expolygons != nullptr)
+        for (const ExPolygon &expolygon : *expolygons)
+            hash_expolygon(seed, expolygon);
+    return seed;
+}
+
+size_t Cache::hash(const PrintRegion *region, coordf_t layer_height, uint32_t layer_flags, const Surface &surface, size_t lower_slices_hash, size_t upper_slices_hash)
+{
+    size_t seed = 0;
+    boost::hash_combine(seed, region);
+    boost::hash_combine(seed, layer_height);
+    boost::hash_combine(seed, layer_flags);
+    boost::hash_combine(seed, uint16_t(surface.surface_type));
+    boost::hash_combine(seed, surface.extra_perimeters);
+    hash_expolygon(seed, surface.expolygon);
+    boost::hash_combine(seed, lower_slices_hash);
+    boost::hash_combine(seed, upper_slices_hash);
+    return seed;
+}
+
+bool Cache::Entry::matches(const Query &query) const
+{
+    auto same_slices = [](const std::optional<ExPolygons> &stored, const ExPolygons *slices) {
+        return stored.has_value() == (slices != nullptr) && (slices == nullptr || *stored == *slices);
+    };
+    const Surface &srf = *query.surface;
+    return region == query.region && layer_height == query.layer_height && layer_flags == query.layer_flags &&
+           surface.surface_type == srf.surface_type && surface.thickness == srf.thickness &&
+           surface.thickness_layers == srf.thickness_layers && surface.bridge_angle == srf.bridge_angle &&
+           surface.extra_perimeters == srf.extra_perimeters && surface.maxNbSolidLayersOnTop == srf.maxNbSolidLayersOnTop &&
+           surface.priority == srf.priority && surface.expolygon == srf.expolygon &&
+           same_slices(lower_slices, query.lower_slices) && same_slices(upper_slices, query.upper_slices);
+}
+
+bool Cache::find(const Query &query, Result &out) const
+{
+    std::shared_ptr<const Result> result;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto range = m_entries.equal_range(query.hash);
+        for (auto it = range.first; it != range.second; ++ it)
+            if (it->second->matches(query)) {
+                result = it->second->result;
+                break;
+            }
+    }
+    if (! result)
+        return false;
+    // Copy outside of the lock, the entry is kept alive by the shared pointer.
+    out = *result;
+    return true;
+}
+
+void Cache::insert(const Query &query, const Result &result)
+{
+    auto entry = std::make_shared<Entry>(Entry{ query.region, query.layer_height, query.layer_flags, *query.surface,
+        query.lower_slices ? std::make_optional(*query.lower_slices) : std::nullopt,
+        query.upper_slices ? std::make_optional(*query.upper_slices) : std::nullopt,
+        std::make_shared<const Result>(result) });
+    std::lock_guard<std::mutex> lock(m_mutex);
+    while (! m_fifo.empty() && m_fifo.size() >= m_max_entries) {
+        auto range = m_entries.equal_range(m_fifo.front().first);
+        for (auto it = range.first; it != range.second; ++ it)
+            if (it->second == m_fifo.front().second) {
+                m_entries.erase(it);
+                break;
+            }
+        m_fifo.pop_front();
+    }
+    m_entries.emplace(query.hash, entry);
+    m_fifo.emplace_back(query.hash, std::move(entry));
+}
+
 
 void assert_check_polygon(const Polygon &polygon) {
 #if _DEBUG
@@ -3039,7 +3139,7 @@ ProcessSurfaceResult PerimeterGenerator::process_arachne(const Parameters &param
             const Polygons         last_p = to_polygons(last);
             Arachne::WallToolPaths wallToolPaths(last_p, params.get_ext_perimeter_spacing(), params.get_ext_perimeter_width(), 
                                                  params.get_perimeter_spacing(), params.get_perimeter_width(), 1, coord_t(0),
-                                                 params.layer->height, params.config, params.print_config);
+                                                 params.layer->height, params.config, params.print_config, params.arachne_cache);
             out_shell = wallToolPaths.getToolPaths();
             // Make sure infill not overlap with wall
             // offset the InnerContour as arachne use bounds and not centerline
@@ -3078,7 +3178,7 @@ ProcessSurfaceResult PerimeterGenerator::process_arachne(const Parameters &param
     Polygons   last_p = to_polygons(last);
     Arachne::WallToolPaths wallToolPaths(last_p, params.get_ext_perimeter_spacing(), params.get_ext_perimeter_width(),
         params.get_perimeter_spacing(), params.get_perimeter_width(), loop_number, coord_t(0),
-        params.layer->height, params.config, params.print_config);
+        params.layer->height, params.config, params.print_config, params.arachne_cache);
     std::vector<Arachne::VariableWidthLines> perimeters = wallToolPaths.getToolPaths();
     
 #if _DEBUG
@@ -4539,13 +4639,15 @@ ProcessSurfaceResult PerimeterGenerator::process_classic(const Parameters &
                         no_thin_zone = diff_ex(last, offset_ex(half_thins, double(min_width / 2 - SCALED_EPSILON)), ApplySafetyOffset::Yes);
                     }
                     ExPolygons thins;
+                    // bounds of each thin, for the medial axis
+                    ExPolygons thin_bounds;
+                    coord_t thin_walls_overlap = scale_t(params.config.thin_walls_overlap.get_abs_value(params.ext_perimeter_flow.nozzle_diameter()));
                     // compute a bit of overlap to anchor thin walls inside the print.
                     for (ExPolygon& half_thin : half_thins) {
                         //growing back the polygon
                         ExPolygons thin = offset_ex(half_thin, double(min_width / 2));
                         assert(thin.size() <= 1);
                         if (thin.empty() || thin.front().empty()) continue;
-                        coord_t thin_walls_overlap = scale_t(params.config.thin_walls_overlap.get_abs_value(params.ext_perimeter_flow.nozzle_diameter()));
                         ExPolygons anchor = intersection_ex(offset_ex(half_thin, double(min_width / 2) +
                             (float)(thin_walls_overlap), jtSquare), no_thin_zone, ApplySafetyOffset::Yes);
                         ExPolygons bounds = union_ex(thin, anchor, ApplySafetyOffset::Yes);
@@ -4556,19 +4658,22 @@ ProcessSurfaceResult PerimeterGenerator::process_classic(const Parameters &
                                 if (thin[0].area() > min_width * (params.get_ext_perimeter_width() + params.get_ext_perimeter_spacing())) {
                                     thins.push_back(thin[0]);
                                     bound.remove_point_too_near(params.get_ext_perimeter_width() / 10);
-                                    // the maximum thickness of our thin wall area is equal to the minimum thickness of a single loop (*1.2 because of circles approx. and enlrgment from 'div')
-                                    Slic3r::Geometry::MedialAxis ma{ thin[0], (coord_t)((params.get_ext_perimeter_width() + params.get_ext_perimeter_spacing()) * 1.2),
-                                        min_width, scale_t(params.layer->height) };
-                                    ma.use_bounds(bound)
-                                        .use_min_real_width(scale_t(params.ext_perimeter_flow.nozzle_diameter()))
-                                        .use_tapers(thin_walls_overlap)
-                                        .set_min_length(params.get_ext_perimeter_width() + params.get_ext_perimeter_spacing())
-                                        .build(thin_walls_thickpolys);
+                                    thin_bounds.push_back(std::move(bound));
                                 }
                                 break;
                             }
                         }
                     }
+                    Slic3r::Geometry::build_medial_axes(thins.size(), [&](size_t idx, ThickPolylines &polylines_out) {
+                        // the maximum thickness of our thin wall area is equal to the minimum thickness of a single loop (*1.2 because of circles approx. and enlrgment from 'div')
+                        Slic3r::Geometry::MedialAxis ma{ thins[idx], (coord_t)((params.get_ext_perimeter_width() + params.get_ext_perimeter_spacing()) * 1.2),
+                            min_width, scale_t(params.layer->height) };
+                        ma.use_bounds(thin_bounds[idx])
+                            .use_min_real_width(scale_t(params.ext_perimeter_flow.nozzle_diameter()))
+                            .use_tapers(thin_walls_overlap)
+                            .set_min_length(params.get_ext_perimeter_width() + params.get_ext_perimeter_spacing())
+                            .build(polylines_out);
+                    }, thin_walls_thickpolys);
                     // use perimeters to extrude area that can't be printed by thin walls
                     // it's a bit like re-add thin area into perimeter area.
                     // it can over-extrude a bit, but it's for a better good.
@@ -5167,8 +5272,8 @@ ProcessSurfaceResult PerimeterGenerator::process_classic(const Parameters &
         }
         // create lines from the area
         ThickPolylines polylines;
-        for (const ExPolygon& ex : gaps_ex) {
-            Geometry::MedialAxis md{ ex, coord_t(real_max), coord_t(min), coord_t(params.layer->height) };
+        Geometry::build_medial_axes(gaps_ex.size(), [&](size_t idx, ThickPolylines &polylines_out) {
+            Geometry::MedialAxis md{ gaps_ex[idx], coord_t(real_max), coord_t(min), coord_t(params.layer->height) };
             if (minlength > 0) {
                 md.set_min_length(minlength);
             }
@@ -5176,8 +5281,8 @@ ProcessSurfaceResult PerimeterGenerator::process_classic(const Parameters &
                 md.set_extension_length(gapfill_extension);
             }
             md.set_biggest_width(max);
-            md.build(polylines);
-        }
+            md.build(polylines_out);
+        }, polylines);
         // create extrusion from lines
         Flow gap_fill_flow = Flow::new_from_width(params.perimeter_flow.width(),
                                                   params.perimeter_flow.nozzle_diameter(),
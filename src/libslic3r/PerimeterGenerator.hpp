@@ -8,7 +8,12 @@
 #define slic3r_PerimeterGenerator_hpp_
 
 #include "libslic3r.h"
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
+#include "Arachne/WallToolPaths.hpp"
 #include "ExtrusionEntityCollection.hpp"
 #include "ClipperUtils.hpp"
 #include "Flow.hpp"
@@ -35,6 +40,8 @@ struct Parameters
     const PrintConfig &      print_config;
     const bool               spiral_vase;
     const bool               use_arachne;
+    // Arachne toolpaths already generated for the other layers of the object, may be null.
+    Arachne::WallToolPathsCache *arachne_cache = nullptr;
 
     // computed parameters (from config)
     const double  m_ext_mm3_per_mm;
@@ -127,6 +134,70 @@ private:
     Parameters() = delete;
 };
 
+// Results of PerimeterGenerator::process() for the islands of an object. The layers of prismatic parts have the same
+// island, the same neighbor layers and the same settings as the layer below, they copy its results instead of generating them again.
+// Only valid during PrintObject::make_perimeters(), as the entries reference the PrintRegions. Thread safe.
+class Cache
+{
+public:
+    struct Result
+    {
+        // Loops with the external thin walls
+        ExtrusionEntityCollection loops;
+        // Gaps without the thin walls
+        ExtrusionEntityCollection gap_fill;
+        // Infills without the gap fills
+        ExPolygons                fill_expolygons;
+        // mask for "no overlap" area
+        ExPolygons                fill_no_overlap;
+    };
+    // Everything the generator reads from the layer, besides the settings of the region.
+    struct Query
+    {
+        const PrintRegion *region;
+        coordf_t           layer_height;
+        // See layer_flags().
+        uint32_t           layer_flags;
+        const Surface     *surface;
+        const ExPolygons  *lower_slices;
+        const ExPolygons  *upper_slices;
+        size_t             hash;
+    };
+
+    // Conditions on the layer id and the spiral vase mode used by the generator.
+    static uint32_t layer_flags(const Parameters &params);
+    static size_t   hash(const ExPolygons *expolygons);
+    static size_t   hash(const PrintRegion *region, coordf_t layer_height, uint32_t layer_flags, const Surface &surface, size_t lower_slices_hash, size_t upper_slices_hash);
+
+    explicit Cache(size_t max_entries = 32) : m_max_entries(max_entries) {}
+
+    // Returns false if these perimeters weren't generated yet.
+    bool find(const Query &query, Result &out) const;
+    void insert(const Query &query, const Result &result);
+
+    // Arachne toolpaths, shared also by the surfaces that differ by their neighbor layers.
+    Arachne::WallToolPathsCache arachne;
+
+private:
+    struct Entry
+    {
+        const PrintRegion            *region;
+        coordf_t                      layer_height;
+        uint32_t                      layer_flags;
+        Surface                       surface;
+        std::optional<ExPolygons>     lower_slices;
+        std::optional<ExPolygons>     upper_slices;
+        std::shared_ptr<const Result> result;
+
+        bool matches(const Query &query) const;
+    };
+    mutable std::mutex                                             m_mutex;
+    std::unordered_multimap<size_t, std::shared_ptr<const Entry>>  m_entries;
+    // Insertion order, the oldest entries are evicted first.
+    std::deque<std::pair<size_t, std::shared_ptr<const Entry>>>    m_fifo;
+    size_t                                                         m_max_entries;
+};
+
 
 
 struct PerimeterIntersectionPoint
@@ -15,6 +15,9 @@
 #include <iomanip>
 #include <sstream>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #ifdef _MSC_VER
     #include <stdlib.h>  // provides **_environ
 #else
@@ -2639,6 +2642,107 @@ static std::string process_macro(const std::string &templ, client::MyContext &co
     return output;
 }
 
+// Most of the custom G-code templates are plain text with a few legacy [variable] expansions and without any {macro}.
+// Such templates are split into literal text and variable references once and the split form is cached,
+// so that processing them again for every layer / tool change does not need to run the full Spirit grammar.
+class CompiledTemplate
+{
+public:
+    // Returns nullptr if the template uses anything beyond plain text, backslash escapes and [identifier].
+    static std::shared_ptr<const CompiledTemplate> compile(const std::string &templ)
+    {
+        auto out = std::make_shared<CompiledTemplate>();
+        out->m_templ = templ;
+        const std::string &t = out->m_templ;
+        std::string literal;
+        for (size_t i = 0; i < t.size();) {
+            const char c = t[i];
+            if (c == '{' || c == '}' || (unsigned char)c >= 0x80)
+                // Macro block or UTF-8 text, leave it to the full parser.
+                return nullptr;
+            if (c == '\\') {
+                if (i + 1 < t.size() && (t[i + 1] == '[' || t[i + 1] == '{')) {
+                    literal += t[i + 1];
+                    i += 2;
+                } else {
+                    literal += c;
+                    ++ i;
+                }
+            } else if (c == '[') {
+                // Only a strict [identifier] is handled here, no white space, no nested index.
+                size_t j = i + 1;
+                if (j == t.size() || ! (std::isalpha((unsigned char)t[j]) || t[j] == '_'))
+                    return nullptr;
+                for (++ j; j < t.size() && (std::isalnum((unsigned char)t[j]) || t[j] == '_'); ++ j) ;
+                if (j == t.size() || t[j] != ']' || g_macro_processor_instance.keywords.find(t.substr(i + 1, j - i - 1)) != nullptr)
+                    return nullptr;
+                out->m_segments.push_back({ std::move(literal), i + 1, j });
+                literal.clear();
+                i = j + 1;
+            } else {
+                literal += c;
+                ++ i;
+            }
+        }
+        if (! literal.empty())
+            out->m_segments.push_back({ std::move(literal), 0, 0 });
+        return out;
+    }
+
+    // May throw, the caller is expected to fall back to the full parser to produce the error message.
+    std::string evaluate(const client::MyContext &context) const
+    {
+        std::string output;
+        std::string value;
+        for (const Segment &segment : m_segments) {
+            output += segment.literal;
+            if (segment.var_begin != segment.var_end) {
+                client::IteratorRange opt_key(m_templ.begin() + segment.var_begin, m_templ.begin() + segment.var_end);
+                value.clear();
+                client::MyContext::legacy_variable_expansion(&context, opt_key, value);
+                output += value;
+            }
+        }
+        return output;
+    }
+
+private:
+    struct Segment {
+        // Literal text to be emitted before the variable.
+        std::string literal;
+        // Position of the variable name inside m_templ, empty range if there is no variable.
+        size_t      var_begin;
+        size_t      var_end;
+    };
+    // Copy of the template, the variable names point into it.
+    std::string          m_templ;
+    std::vector<Segment> m_segments;
+};
+
+// Returns nullptr if the template has to be processed by the full parser.
+static std::shared_ptr<const CompiledTemplate> compiled_template(const std::string &templ)
+{
+    // Don't cache the templates which are likely to be evaluated just once.
+    static constexpr size_t max_cached_length = 4096;
+    static constexpr size_t max_cached_templates = 1024;
+    if (templ.size() > max_cached_length)
+        return nullptr;
+    static std::mutex mutex;
+    // Unsupported templates are cached as nullptr to not try to compile them again.
+    static std::unordered_map<std::string, std::shared_ptr<const CompiledTemplate>> cache;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (auto it = cache.find(templ); it != cache.end())
+            return it->second;
+    }
+    std::shared_ptr<const CompiledTemplate> compiled = CompiledTemplate::compile(templ);
+    std::lock_guard<std::mutex> lock(mutex);
+    if (cache.size() >= max_cached_templates)
+        cache.clear();
+    cache.emplace(templ, compiled);
+    return compiled;
+}
+
 std::string PlaceholderParser::process(const std::string &templ, unsigned int current_extruder_id, const DynamicConfig *config_override, DynamicConfig *config_outputs, ContextData *context_data) const
 {
     client::MyContext context;
@@ -2648,6 +2752,13 @@ std::string PlaceholderParser::process(const std::string &templ, unsigned int cu
     context.config_outputs      = config_outputs;
     context.current_extruder_id = current_extruder_id;
     context.context_data        = context_data;
+    if (std::shared_ptr<const CompiledTemplate> compiled = compiled_template(templ); compiled) {
+        try {
+            return compiled->evaluate(context);
+        } catch (...) {
+            // Let the full parser report the error.
+        }
+    }
     return process_macro(templ, context);
 }
 
@@ -587,45 +587,123 @@ void concatThickPolylines(ThickPolylines& pp) {
 //    return {};
 //}
 
-bool not_arc(const ArcPolyline& arcs)
+const ArcPolyline::ArcSegment *ArcPolyline::find_arc(size_t idx) const
 {
-    for (const Geometry::ArcWelder::Segment &s : arcs.get_arc())
-        if (s.radius != 0)
-            return false;
-    return true;
+    auto it = std::lower_bound(m_arcs.begin(), m_arcs.end(), idx,
+                               [](const ArcSegment &arc, size_t i) { return arc.index < i; });
+    return it != m_arcs.end() && it->index == idx ? &(*it) : nullptr;
+}
+
+void ArcPolyline::erase_point(size_t idx)
+{
+    assert(idx < m_points.size());
+    m_points.erase(m_points.begin() + idx);
+    auto it = std::lower_bound(m_arcs.begin(), m_arcs.end(), idx,
+                               [](const ArcSegment &arc, size_t i) { return arc.index < i; });
+    if (it != m_arcs.end() && it->index == idx)
+        it = m_arcs.erase(it);
+    for (; it != m_arcs.end(); ++it)
+        --it->index;
+    // first point can't be an arc
+    if (!m_arcs.empty() && m_arcs.front().index == 0)
+        m_arcs.erase(m_arcs.begin());
+}
+
+void ArcPolyline::set_path(const Geometry::ArcWelder::Path &path)
+{
+    m_points.clear();
+    m_arcs.clear();
+    m_points.reserve(path.size());
+    for (const Geometry::ArcWelder::Segment &seg : path) {
+        if (!seg.linear() && !m_points.empty())
+            m_arcs.push_back({m_points.size(), seg.radius, seg.orientation});
+        m_points.push_back(seg.point);
+    }
+}
+
+Geometry::ArcWelder::Path ArcPolyline::get_arc() const
+{
+    Geometry::ArcWelder::Path path;
+    path.reserve(m_points.size());
+    auto it_arc = m_arcs.begin();
+    for (size_t idx = 0; idx < m_points.size(); ++idx) {
+        if (it_arc != m_arcs.end() && it_arc->index == idx) {
+            path.emplace_back(m_points[idx], it_arc->radius, it_arc->orientation);
+#ifdef _DEBUG
+            path.back().length = Geometry::ArcWelder::segment_length<coordf_t>(path[idx - 1], path.back());
+            path.back().center = Geometry::ArcWelder::arc_center_scalar(m_points[idx - 1], m_points[idx], it_arc->radius, path.back().ccw());
+#endif
+            ++it_arc;
+        } else {
+            path.emplace_back(m_points[idx], 0.f, Geometry::ArcWelder::Orientation::Unknown);
+        }
+    }
+    assert(it_arc == m_arcs.end());
+    return path;
+}
+
+Geometry::ArcWelder::Segment ArcPolyline::get_arc(size_t i) const
+{
+    const ArcSegment *arc = this->find_arc(i);
+    if (arc == nullptr)
+        return Geometry::ArcWelder::Segment(m_points[i]);
+    Geometry::ArcWelder::Segment seg(m_points[i], arc->radius, arc->orientation);
+#ifdef _DEBUG
+    seg.length = Geometry::ArcWelder::arc_length(m_points[i - 1].cast<coordf_t>(), m_points[i].cast<coordf_t>(), coordf_t(arc->radius));
+    seg.center = Geometry::ArcWelder::arc_center_scalar(m_points[i - 1], m_points[i], arc->radius, seg.ccw());
+#endif
+    return seg;
 }
 
-ArcPolyline::ArcPolyline(const Geometry::ArcWelder::Path &other) : m_path(other) {
-    m_only_strait = not_arc(*this);
+void ArcPolyline::reverse()
+{
+    std::reverse(m_points.begin(), m_points.end());
+    if (!m_arcs.empty()) {
+        // The arc ending at point i now ends at point size - i, and is travelled in the other direction.
+        std::reverse(m_arcs.begin(), m_arcs.end());
+        for (ArcSegment &arc : m_arcs) {
+            arc.index       = m_points.size() - arc.index;
+            arc.orientation = arc.orientation == Geometry::ArcWelder::Orientation::CCW ? Geometry::ArcWelder::Orientation::CW :
+                                                                                         Geometry::ArcWelder::Orientation::CCW;
+        }
+    }
 }
 
-bool ArcPolyline::has_arc() const {
-    assert(not_arc(*this) == m_only_strait);
-    return !m_only_strait;
+coordf_t ArcPolyline::length() const
+{
+    coordf_t len = 0;
+    auto it_arc = m_arcs.begin();
+    for (size_t i = 1; i < m_points.size(); ++ i) {
+        if (it_arc != m_arcs.end() && it_arc->index == i) {
+            len += Geometry::ArcWelder::arc_length(m_points[i - 1].cast<coordf_t>(), m_points[i].cast<coordf_t>(), coordf_t(it_arc->radius));
+            ++it_arc;
+        } else {
+            len += (m_points[i] - m_points[i - 1]).cast<coordf_t>().norm();
+        }
+    }
+    return len;
 }
 
-void ArcPolyline::clear() {
-    m_path.clear();
-    m_only_strait = true;
+void ArcPolyline::append_before(const Point &point)
+{
+    m_points.insert(m_points.begin(), point);
+    for (ArcSegment &arc : m_arcs)
+        ++arc.index;
 }
 
 void ArcPolyline::append(const Points &src)
 {
     assert(this->empty() || src.empty() || src.front().coincides_with_epsilon(this->back()));
-    for (size_t i = 1; i < src.size(); ++i) {
-        const Point &point = src[i];
-        m_path.emplace_back(point, 0.f, Geometry::ArcWelder::Orientation::Unknown);
-    }
+    if (src.size() > 1)
+        m_points.insert(m_points.end(), src.begin() + 1, src.end());
     assert(is_valid());
 }
 
 void ArcPolyline::append(Points &&src)
 {
     assert(this->empty() || src.empty() || src.front().coincides_with_epsilon(this->back()));
-    for (size_t i = 1; i < src.size(); ++i) {
-        const Point &point = src[i];
-        m_path.emplace_back(std::move(point), 0, Geometry::ArcWelder::Orientation::Unknown);
-    }
+    if (src.size() > 1)
+        m_points.insert(m_points.end(), std::make_move_iterator(src.begin() + 1), std::make_move_iterator(src.end()));
     assert(is_valid());
 }
 
@@ -636,23 +714,20 @@ void ArcPolyline::append(const Points::const_iterator &begin, const Points::cons
     if (it != end && begin->coincides_with_epsilon(this->back())) {
         ++it;
     }
-    while (it != end) {
-        m_path.emplace_back(*it, 0, Geometry::ArcWelder::Orientation::Unknown);
-        ++it;
-    }
+    m_points.insert(m_points.end(), it, end);
     assert(is_valid());
 }
 
 void ArcPolyline::append(const ArcPolyline &src)
 {
     assert(this->empty() || this->is_valid());
-    this->m_only_strait &= src.m_only_strait;
-    if (m_path.empty()) {
-        m_path = std::move(src.m_path);
-    } else if (src.m_path.front().point == this->m_path.back().point) {
+    if (m_points.empty()) {
+        m_points = src.m_points;
+        m_arcs   = src.m_arcs;
+    } else if (src.front() == this->back()) {
         if (src.size() > 1) {
             bool epsilon_merge = false;
-            if (!this->empty() && this->m_only_strait && src.m_only_strait) {
+            if (!this->empty() && !this->has_arc() && !src.has_arc()) {
                 epsilon_merge = this->size() == 2 && this->front().coincides_with_epsilon(this->back());
                 if (!epsilon_merge) {
                     epsilon_merge = (this->back().coincides_with_epsilon(src.get_point(1)));
@@ -660,30 +735,28 @@ void ArcPolyline::append(const ArcPolyline &src)
                 }
             }
             if (epsilon_merge) {
-                m_path.back().point = src.get_point(1);
+                m_points.back() = src.get_point(1);
                 if (src.size() > 2) {
                     const size_t next_size = this->size() + src.size() - 2;
-                    //m_path.reserve(next_size);
-                    this->m_path.insert(this->m_path.end(), src.m_path.begin() + 2, src.m_path.end());
-                    assert(next_size == m_path.size());
+                    this->m_points.insert(this->m_points.end(), src.m_points.begin() + 2, src.m_points.end());
+                    assert(next_size == m_points.size());
                 }
             } else {
                 assert(src.is_valid());
-                const size_t next_size = m_path.size() + src.m_path.size() - 1;
-                //m_path.reserve(next_size);
-                // std::move(src.m_path.begin() + 1, src.m_path.end(), std::back_inserter(m_path));
-                this->m_path.insert(this->m_path.end(), src.m_path.begin() + 1, src.m_path.end());
-                assert(next_size == m_path.size());
+                const size_t offset = m_points.size() - 1;
+                this->m_points.insert(this->m_points.end(), src.m_points.begin() + 1, src.m_points.end());
+                for (const ArcSegment &arc : src.m_arcs)
+                    this->m_arcs.push_back({arc.index + offset, arc.radius, arc.orientation});
+                assert(offset + src.size() == m_points.size());
             }
         }
     } else {
         // weird, are you sure you want to append it?
         assert(false);
-        const size_t next_size = m_path.size() + src.m_path.size();
-        //m_path.reserve(next_size);
-        //std::move(src.m_path.begin(), src.m_path.end(), std::back_inserter(m_path));
-        this->m_path.insert(this->m_path.end(), src.m_path.begin(), src.m_path.end());
-        assert(next_size == m_path.size());
+        const size_t offset = m_points.size();
+        this->m_points.insert(this->m_points.end(), src.m_points.begin(), src.m_points.end());
+        for (const ArcSegment &arc : src.m_arcs)
+            this->m_arcs.push_back({arc.index + offset, arc.radius, arc.orientation});
     }
     assert(is_valid());
 }
@@ -695,66 +768,60 @@ void ArcPolyline::append(ArcPolyline &&src) {
     Point pt_back = src.back();
     assert(src.is_valid());
     assert(empty() || is_valid());
-    this->m_only_strait &= src.m_only_strait;
-    if (m_path.empty()) {
-        m_path = std::move(src.m_path);
-    } else if (src.m_path.front().point == this->m_path.back().point) {
+    if (m_points.empty()) {
+        m_points = std::move(src.m_points);
+        m_arcs   = std::move(src.m_arcs);
+    } else if (src.front() == this->back()) {
         if (src.size() > 1) {
-            const size_t next_size = m_path.size() + src.m_path.size() - 1;
-            //m_path.reserve(next_size);
-            m_path.insert(m_path.end(), std::make_move_iterator(src.m_path.begin() + 1), std::make_move_iterator(src.m_path.end()));
+            const size_t offset = m_points.size() - 1;
+            m_points.insert(m_points.end(), std::make_move_iterator(src.m_points.begin() + 1), std::make_move_iterator(src.m_points.end()));
+            for (const ArcSegment &arc : src.m_arcs)
+                m_arcs.push_back({arc.index + offset, arc.radius, arc.orientation});
             assert(is_valid());
-            assert(next_size == m_path.size());
         }
     } else {
         // weird, are you sure you want to append it?
         assert(false);
-        const size_t next_size = m_path.size() + src.m_path.size();
-        //m_path.reserve(next_size);
-        m_path.insert(m_path.end(), std::make_move_iterator(src.m_path.begin()), std::make_move_iterator(src.m_path.end()));
-        assert(next_size == m_path.size());
+        const size_t offset = m_points.size();
+        m_points.insert(m_points.end(), std::make_move_iterator(src.m_points.begin()), std::make_move_iterator(src.m_points.end()));
+        for (const ArcSegment &arc : src.m_arcs)
+            m_arcs.push_back({arc.index + offset, arc.radius, arc.orientation});
     }
     assert(is_valid());
-    assert(m_path.back().point == pt_back);
+    assert(m_points.back() == pt_back);
 }
 void ArcPolyline::append(const Geometry::ArcWelder::Segment &arc)
 {
     assert(arc.radius == 0 || !this->empty());
     assert(arc.radius != 0 || arc.orientation == Geometry::ArcWelder::Orientation::Unknown);
-    this->m_path.push_back(arc);
-    if (arc.radius != 0) {
-        this->m_only_strait = false;
-    }
-#ifdef _DEBUG
-    if (this->m_path.size() > 1) {
-        this->m_path.back().length = Geometry::ArcWelder::segment_length<coordf_t>(this->m_path[this->m_path.size() - 2], this->m_path.back());
-    }
-#endif
+    if (arc.radius != 0)
+        this->m_arcs.push_back({this->m_points.size(), arc.radius, arc.orientation});
+    this->m_points.push_back(arc.point);
     assert(is_valid());
 }
 
 void ArcPolyline::translate(const Vector &vector)
 {
-    for (auto &seg : m_path)
-        seg.point += vector;
+    for (Point &pt : m_points)
+        pt += vector;
     assert(is_valid());
 }
 void ArcPolyline::rotate(double angle)
 {
     double cos_angle = cos(angle), sin_angle = sin(angle);
-    for (auto &seg : this->m_path) {
-        double cur_x  = double(seg.point.x());
-        double cur_y  = double(seg.point.y());
-        seg.point.x() = coord_t(round(cos_angle * cur_x - sin_angle * cur_y));
-        seg.point.y() = coord_t(round(cos_angle * cur_y + sin_angle * cur_x));
+    for (Point &pt : this->m_points) {
+        double cur_x = double(pt.x());
+        double cur_y = double(pt.y());
+        pt.x()       = coord_t(round(cos_angle * cur_x - sin_angle * cur_y));
+        pt.y()       = coord_t(round(cos_angle * cur_y + sin_angle * cur_x));
     }
     assert(is_valid());
 }
 
 int ArcPolyline::find_point(const Point &point) const
 {
-    for (size_t idx = 0; idx < this->m_path.size(); ++idx)
-        if (m_path[idx].point == point)
+    for (size_t idx = 0; idx < this->m_points.size(); ++idx)
+        if (m_points[idx] == point)
             return int(idx);
     return -1; // not found
 }
@@ -765,12 +832,12 @@ int ArcPolyline::find_point(const Point &point, coordf_t epsilon) const
     const int fast_result = this->find_point(point);
     if (epsilon == 0 || fast_result >= 0)
         return fast_result;
-    if (this->m_only_strait) {
+    if (!this->has_arc()) {
         auto dist2_min = std::numeric_limits<double>::max();
         auto eps2      = epsilon * epsilon;
         int  idx_min   = -1;
-        for (size_t idx = 0; idx < this->m_path.size(); ++idx) {
-            double d2 = (this->m_path[idx].point - point).cast<double>().squaredNorm();
+        for (size_t idx = 0; idx < this->m_points.size(); ++idx) {
+            double d2 = (this->m_points[idx] - point).cast<double>().squaredNorm();
             if (d2 < dist2_min) {
                 idx_min   = int(idx);
                 dist2_min = d2;
@@ -778,16 +845,16 @@ int ArcPolyline::find_point(const Point &point, coordf_t epsilon) const
         }
         return dist2_min < eps2 ? idx_min : -1;
     } else {
-        Geometry::ArcWelder::PathSegmentProjection result = Geometry::ArcWelder::point_to_path_projection(m_path, point);
+        Geometry::ArcWelder::PathSegmentProjection result = Geometry::ArcWelder::point_to_path_projection(this->get_arc(), point);
         if (result.distance2 > epsilon * epsilon)
             return -1;
-        if (result.segment_id + 1 == m_path.size()) {
+        if (result.segment_id + 1 == m_points.size()) {
             // i guess it's not possible?
             assert(false);
-            return (this->m_path[result.segment_id].point - point).cast<double>().squaredNorm() < epsilon * epsilon ? result.segment_id : -1;
+            return (this->m_points[result.segment_id] - point).cast<double>().squaredNorm() < epsilon * epsilon ? result.segment_id : -1;
         } else {
-            coordf_t first_dist = (this->m_path[result.segment_id].point - point).cast<double>().squaredNorm();
-            coordf_t second_dist = (this->m_path[result.segment_id + 1].point - point).cast<double>().squaredNorm();
+            coordf_t first_dist = (this->m_points[result.segment_id] - point).cast<double>().squaredNorm();
+            coordf_t second_dist = (this->m_points[result.segment_id + 1] - point).cast<double>().squaredNorm();
             int idx_min = first_dist < second_dist ? result.segment_id : (result.segment_id + 1);
             return std::min(first_dist, second_dist) <= epsilon * epsilon ? idx_min : -1;
         }
@@ -796,54 +863,62 @@ int ArcPolyline::find_point(const Point &point, coordf_t epsilon) const
 
 bool ArcPolyline::at_least_length(coordf_t length) const
 {
-    for (size_t i = 1; length > 0 && i < m_path.size(); ++ i)
-        length -= Geometry::ArcWelder::segment_length<double>(m_path[i - 1], m_path[i]);
+    auto it_arc = m_arcs.begin();
+    for (size_t i = 1; length > 0 && i < m_points.size(); ++ i) {
+        if (it_arc != m_arcs.end() && it_arc->index == i) {
+            length -= Geometry::ArcWelder::arc_length(m_points[i - 1].cast<double>(), m_points[i].cast<double>(), double(it_arc->radius));
+            ++it_arc;
+        } else {
+            length -= (m_points[i] - m_points[i - 1]).cast<double>().norm();
+        }
+    }
     return length <= 0;
 }
 
 //for seams
 std::pair<int, Point> ArcPolyline::foot_pt(const Point &pt) const
 {
-    if (m_path.size() < 2)
+    if (m_points.size() < 2)
         return std::make_pair(-1, Point(0, 0));
 
-    if (this->m_only_strait) {
+    if (!this->has_arc()) {
         auto  d2_min = std::numeric_limits<double>::max();
         Point foot_pt_min;
         size_t foot_idx_min = 0;
-        Point prev    = m_path.front().point;
-        for (size_t idx = 1; idx < m_path.size(); ++idx) {
+        Point prev    = m_points.front();
+        for (size_t idx = 1; idx < m_points.size(); ++idx) {
             Point foot_pt;
-            if (double d2 = line_alg::distance_to_squared(Line(prev, m_path[idx].point), pt, &foot_pt); d2 < d2_min) {
+            if (double d2 = line_alg::distance_to_squared(Line(prev, m_points[idx]), pt, &foot_pt); d2 < d2_min) {
                 d2_min      = d2;
                 foot_pt_min = foot_pt;
                 foot_idx_min = idx;
             }
-            prev = m_path[idx].point;
+            prev = m_points[idx];
         }
         return std::make_pair(int(foot_idx_min) - 1, foot_pt_min);
     } else {
-        Geometry::ArcWelder::PathSegmentProjection result = Geometry::ArcWelder::point_to_path_projection(m_path, pt);
+        const Geometry::ArcWelder::Path path = this->get_arc();
+        Geometry::ArcWelder::PathSegmentProjection result = Geometry::ArcWelder::point_to_path_projection(path, pt);
         // check that if last point, then it's really the last point
-        //assert(result.segment_id + 1 < m_path.size() ||
-        //       (m_path.back().point.distance_to(pt) - std::sqrt(result.distance2)) < SCALED_EPSILON);
+        //assert(result.segment_id + 1 < path.size() ||
+        //       (path.back().point.distance_to(pt) - std::sqrt(result.distance2)) < SCALED_EPSILON);
         // else check that if on strait segment, it's proj into it.
-        assert(result.segment_id + 1 == m_path.size() || m_path[result.segment_id + 1].radius != 0 ||
+        assert(result.segment_id + 1 == path.size() || path[result.segment_id + 1].radius != 0 ||
                result.point.distance_to(
-                   result.point.projection_onto(m_path[result.segment_id].point, m_path[result.segment_id + 1].point)) < SCALED_EPSILON);
+                   result.point.projection_onto(path[result.segment_id].point, path[result.segment_id + 1].point)) < SCALED_EPSILON);
         // else check that it's on the arc
-        assert(result.segment_id + 1 == m_path.size() || m_path[result.segment_id + 1].radius == 0
-            || m_path[result.segment_id + 1].point == result.point || m_path[result.segment_id].point == result.point
-            || Geometry::ArcWelder::point_to_path_projection({m_path[result.segment_id], m_path[result.segment_id + 1]},
+        assert(result.segment_id + 1 == path.size() || path[result.segment_id + 1].radius == 0
+            || path[result.segment_id + 1].point == result.point || path[result.segment_id].point == result.point
+            || Geometry::ArcWelder::point_to_path_projection({path[result.segment_id], path[result.segment_id + 1]},
                                                                       result.point,
                                                                       (result.distance2) + SCALED_EPSILON * 2).point.distance_to(result.point) < SCALED_EPSILON);
         // if on strait segment, then no center, if on arc, then there is a center. (unless it's the first or last point)
-        if (result.segment_id > 0 && result.segment_id + 1 < m_path.size()) {
+        if (result.segment_id > 0 && result.segment_id + 1 < path.size()) {
             bool has_center = result.center != Point(0, 0);
-            bool has_radius = m_path[result.segment_id + 1].radius != 0;
+            bool has_radius = path[result.segment_id + 1].radius != 0;
             assert((has_center && has_radius) || (!has_center && !has_radius)
-                || m_path[result.segment_id].point == result.point
-                || (m_path[result.segment_id+1].point == result.point && result.segment_id+2 == m_path.size()));
+                || path[result.segment_id].point == result.point
+                || (path[result.segment_id+1].point == result.point && result.segment_id+2 == path.size()));
         }
         // arc: projection
         return std::make_pair(int(result.segment_id), result.point);
@@ -853,85 +928,104 @@ std::pair<int, Point> ArcPolyline::foot_pt(const Point &pt) const
 
 void ArcPolyline::pop_front()
 {
-    assert(m_only_strait);
-    assert(m_path.size() > 2);
-    m_path.erase(m_path.begin());
-    if (!m_path.empty()) {
-        m_path.front().radius = 0.f;
-        m_path.front().orientation = Geometry::ArcWelder::Orientation::Unknown;
-    }
-    if (!m_only_strait)
-        m_only_strait = not_arc(*this);
+    assert(!has_arc());
+    assert(m_points.size() > 2);
+    this->erase_point(0);
     assert(is_valid());
 }
 
 void ArcPolyline::pop_back()
 {
-    assert(m_only_strait);
-    assert(m_path.size() > 2);
-    m_path.pop_back();
-    if (!m_only_strait)
-        m_only_strait = not_arc(*this);
+    assert(!has_arc());
+    assert(m_points.size() > 2);
+    m_points.pop_back();
+    if (!m_arcs.empty() && m_arcs.back().index == m_points.size())
+        m_arcs.pop_back();
     assert(is_valid());
 }
 
 void ArcPolyline::clip_start(coordf_t dist)
 {
-    Geometry::ArcWelder::clip_start(m_path, dist);
-    if (!m_only_strait)
-        m_only_strait = not_arc(*this);
-    assert(is_valid());
+    // same as Geometry::ArcWelder::clip_start
+    this->reverse();
+    this->clip_end(dist);
+    this->reverse();
 }
 
 void ArcPolyline::clip_end(coordf_t dist)
 {
-    Geometry::ArcWelder::clip_end(m_path, dist);
-    if (!m_only_strait)
-        m_only_strait = not_arc(*this);
+    if (this->has_arc()) {
+        Geometry::ArcWelder::Path path = this->get_arc();
+        Geometry::ArcWelder::clip_end(path, dist);
+        this->set_path(path);
+    } else {
+        // Only strait segments: same as Geometry::ArcWelder::clip_end, directly on the points.
+        while (dist > 0) {
+            const Point last = m_points.back();
+            m_points.pop_back();
+            if (m_points.empty())
+                break;
+            Vec2d  v    = (m_points.back() - last).cast<coordf_t>();
+            double lsqr = v.squaredNorm();
+            if (lsqr > sqr(dist + SCALED_EPSILON)) {
+                m_points.push_back(last + Point::round(v * (dist / sqrt(lsqr))));
+                break;
+            }
+            dist -= sqrt(lsqr);
+            // check if not the same point as the one we just deleted.
+            if (dist < 0) {
+                assert(dist > -SCALED_EPSILON);
+                m_points.push_back(last);
+            }
+        }
+    }
     assert(is_valid());
 }
 
 void ArcPolyline::split_at(coordf_t distance, ArcPolyline &p1, ArcPolyline &p2) const
 {
-    if (m_path.empty()) return;
+    if (m_points.empty()) return;
     assert(distance > SCALED_EPSILON);
     if (distance < SCALED_EPSILON) return;
     assert(this->is_valid());
-    p1.m_path.push_back(m_path.front());
+    const Geometry::ArcWelder::Path path = this->get_arc();
+    Geometry::ArcWelder::Path p1_path;
+    Geometry::ArcWelder::Path p2_path;
+    p1_path.push_back(path.front());
 #ifdef _DEBUG
     coordf_t length_tot_split = 0;
 #endif
     size_t idx = 1;
-    while(distance > 0 && idx < m_path.size()) {
-        const Geometry::ArcWelder::Segment current = m_path[idx];
+    while(distance > 0 && idx < path.size()) {
+        const Geometry::ArcWelder::Segment current = path[idx];
         if (current.linear()) {
             // Linear segment
-            Vec2d  v    = (current.point - p1.back()).cast<double>();
+            Vec2d  v    = (current.point - p1_path.back().point).cast<double>();
             double lsqr = v.squaredNorm();
             if (lsqr > sqr(distance)) {
 #ifdef _DEBUG
                 length_tot_split = current.length;
                 assert(length_tot_split == 0);
 #endif
-                Point split_point = p1.back() + Point::round(v * (distance / sqrt(lsqr)));
-                p1.m_path.push_back({split_point, 0, Geometry::ArcWelder::Orientation::Unknown});
-                p2.m_path.push_back({split_point, 0, Geometry::ArcWelder::Orientation::Unknown});
-                p2.m_path.push_back(current);
+                Point split_point = p1_path.back().point + Point::round(v * (distance / sqrt(lsqr)));
+                p1_path.push_back({split_point, 0, Geometry::ArcWelder::Orientation::Unknown});
+                p2_path.push_back({split_point, 0, Geometry::ArcWelder::Orientation::Unknown});
+                p2_path.push_back(current);
                 // Length to go is zero.
                 distance = 0;
             } else {
-                p1.m_path.push_back(current);
+                p1_path.push_back(current);
                 distance -= sqrt(lsqr);
             }
         } else {
 #ifdef _DEBUG
                 length_tot_split = current.length;
                 assert(length_tot_split > 0);
-                Point startp = p1.back();
+                Point startp = p1_path.back().point;
 #endif
             // Circular segment
             //double angle = Geometry::ArcWelder::arc_angle(path.back().point.cast<double>(), last.point.cast<double>(), last.radius);
-            double angle = Geometry::ArcWelder::arc_angle(p1.back().cast<double>(), current.point.cast<double>(), current.radius);
+            double angle = Geometry::ArcWelder::arc_angle(p1_path.back().point.cast<double>(), current.point.cast<double>(), current.radius);
             assert(angle > 0);
             //double len   = std::abs(last.radius) * angle;
             double len   = std::abs(current.radius) * angle;
@@ -940,24 +1034,24 @@ void ArcPolyline::split_at(coordf_t distance, ArcPolyline &p1, ArcPolyline &p2)
                 // Rotate the segment end point in reverse towards the start point.
                 if (!current.ccw())
                     angle *= -1.;
-                const Vec2d center = Geometry::ArcWelder::arc_center(p1.back().cast<double>(), current.point.cast<double>(), double(current.radius), current.ccw());
-                const Point split_point = p1.back().rotated(angle * (distance / len), Point::round(center));
-                p1.m_path.push_back({split_point, current.radius, current.orientation });
-                p2.m_path.push_back({split_point, 0, Geometry::ArcWelder::Orientation::Unknown});
-                p2.m_path.push_back(current);
+                const Vec2d center = Geometry::ArcWelder::arc_center(p1_path.back().point.cast<double>(), current.point.cast<double>(), double(current.radius), current.ccw());
+                const Point split_point = p1_path.back().point.rotated(angle * (distance / len), Point::round(center));
+                p1_path.push_back({split_point, current.radius, current.orientation });
+                p2_path.push_back({split_point, 0, Geometry::ArcWelder::Orientation::Unknown});
+                p2_path.push_back(current);
                 // the arc is now shorter, if radius negative then is was using the big one. In this case, check if the segment isn't now the shorter one.
                 if (current.radius < 0) {
                     assert(std::abs(angle) > PI);
                     int nb_reverse = 0;
                     if (std::abs(angle) * (distance / len) < PI) {
-                        p1.m_path.back().radius = (-p1.m_path.back().radius);
+                        p1_path.back().radius = (-p1_path.back().radius);
                         nb_reverse++;
-                        assert(p1.m_path.back().radius > 0);
+                        assert(p1_path.back().radius > 0);
                     }
                     if (std::abs(angle) * (1- (distance / len)) < PI) {
-                        p2.m_path[1].radius = (-p2.m_path[1].radius);
+                        p2_path[1].radius = (-p2_path[1].radius);
                         nb_reverse++;
-                        assert(p2.m_path[1].radius > 0);
+                        assert(p2_path[1].radius > 0);
                     }
                     assert(nb_reverse > 0);
                 }
@@ -965,73 +1059,71 @@ void ArcPolyline::split_at(coordf_t distance, ArcPolyline &p1, ArcPolyline &p2)
                 Point almost_current = startp.rotated(angle, Point::round(center));
                 Point almost_current2 = startp.rotated(angle, current.center);
                 assert(almost_current.coincides_with_epsilon(current.point));
-                assert(p1.back() == split_point);
-                double part1 = Geometry::ArcWelder::arc_length(startp, split_point, double(p1.m_path.back().radius));
-                double part1b = Geometry::ArcWelder::arc_length(startp, split_point, double(-p1.m_path.back().radius));
-                assert(current.point == p2.m_path[1].point);
-                double part2 = Geometry::ArcWelder::arc_length(split_point, current.point, double(p2.m_path[1].radius));
+                assert(p1_path.back().point == split_point);
+                double part1 = Geometry::ArcWelder::arc_length(startp, split_point, double(p1_path.back().radius));
+                double part1b = Geometry::ArcWelder::arc_length(startp, split_point, double(-p1_path.back().radius));
+                assert(current.point == p2_path[1].point);
+                double part2 = Geometry::ArcWelder::arc_length(split_point, current.point, double(p2_path[1].radius));
                 double tot = Geometry::ArcWelder::arc_length(startp, current.point, double(current.radius));
                 assert(is_approx(part1 + part2, tot, 1. * SCALED_EPSILON));
 #endif
                 // Length to go is zero.
                 distance = 0;
             } else {
-                p1.m_path.push_back(current);
+                p1_path.push_back(current);
                 distance -= len;
             }
         }
         //increment
         ++idx;
     }
-    assert(!p2.empty());
-    assert(p1.m_path.back().point == p2.m_path[0].point);
+    assert(!p2_path.empty());
+    assert(p1_path.back().point == p2_path[0].point);
     //now fill p2
-    while (idx < m_path.size()) {
-        p2.m_path.push_back(m_path[idx]);
+    while (idx < path.size()) {
+        p2_path.push_back(path[idx]);
         // increment
         ++idx;
     }
-    assert(!p2.empty());
-    if (p2.back() != back()) {
-        if (p2.size() == 1 || !p2.back().coincides_with_epsilon(back())) {
-            p2.m_path.push_back(back());
+    assert(!p2_path.empty());
+    if (p2_path.back().point != back()) {
+        if (p2_path.size() == 1 || !p2_path.back().point.coincides_with_epsilon(back())) {
+            p2_path.push_back(back());
         } else {
             // even with arc, the difference is not measurable (less than epsilon)
-            p2.set_back(back());
+            p2_path.back() = Geometry::ArcWelder::Segment(back());
         }
     }
     //check if the last p1 segment is long enough
-    if (p1.size() > 3 && p1.back().distance_to_square(p1.get_point(p1.size()-2)) < SCALED_EPSILON * SCALED_EPSILON) {
+    if (p1_path.size() > 3 && p1_path.back().point.distance_to_square(p1_path[p1_path.size()-2].point) < SCALED_EPSILON * SCALED_EPSILON) {
         //to short of a segment, move the previous point (even if arc, should be short enough of a move)
-        p1.m_path[p1.size()-2].point = p1.back();
-        p1.m_path.pop_back();
-    }
-    if (has_arc()) {
-        p1.m_only_strait = not_arc(p1);
-        p2.m_only_strait = not_arc(p2);
+        p1_path[p1_path.size()-2].point = p1_path.back().point;
+        p1_path.pop_back();
     }
 #ifdef _DEBUG
-    assert(p1.m_path.back().point == p2.m_path[0].point);
-    if (p1.size() > 1 && p2.size() > 1 && (p1.m_path.back().radius != 0 || p2.m_path[1].radius != 0) ) {
-        assert(std::abs(p1.m_path.back().radius) == std::abs(p2.m_path[1].radius));
-        assert(p1.m_path.back().length ==0 && p2.m_path[1].length > 0);
-        coordf_t length_old_p1 = p1.m_path.back().length;
-        coordf_t length_old_p2 = p2.m_path[1].length;
-        p1.m_path.back().length = Geometry::ArcWelder::segment_length<coordf_t>(p1.m_path[p1.m_path.size()-2], p1.m_path.back());
-        p1.m_path.back().center = Geometry::ArcWelder::arc_center_scalar(p1.m_path[p1.m_path.size()-2].point, p1.m_path.back().point, p1.m_path.back().radius, p1.m_path.back().ccw());
-        p2.m_path[1].length = Geometry::ArcWelder::segment_length<coordf_t>(p2.m_path[0], p2.m_path[1]);
-        p2.m_path[1].center = Geometry::ArcWelder::arc_center_scalar(p2.m_path[0].point, p2.m_path[1].point, p2.m_path[1].radius, p2.m_path[1].ccw());
-        assert(is_approx(length_tot_split, p1.m_path.back().length + p2.m_path[1].length, 1. * SCALED_EPSILON));
+    assert(p1_path.back().point == p2_path[0].point);
+    if (p1_path.size() > 1 && p2_path.size() > 1 && (p1_path.back().radius != 0 || p2_path[1].radius != 0) ) {
+        assert(std::abs(p1_path.back().radius) == std::abs(p2_path[1].radius));
+        assert(p1_path.back().length ==0 && p2_path[1].length > 0);
+        coordf_t length_old_p1 = p1_path.back().length;
+        coordf_t length_old_p2 = p2_path[1].length;
+        p1_path.back().length = Geometry::ArcWelder::segment_length<coordf_t>(p1_path[p1_path.size()-2], p1_path.back());
+        p1_path.back().center = Geometry::ArcWelder::arc_center_scalar(p1_path[p1_path.size()-2].point, p1_path.back().point, p1_path.back().radius, p1_path.back().ccw());
+        p2_path[1].length = Geometry::ArcWelder::segment_length<coordf_t>(p2_path[0], p2_path[1]);
+        p2_path[1].center = Geometry::ArcWelder::arc_center_scalar(p2_path[0].point, p2_path[1].point, p2_path[1].radius, p2_path[1].ccw());
+        assert(is_approx(length_tot_split, p1_path.back().length + p2_path[1].length, 1. * SCALED_EPSILON));
     }
-    for (size_t i = 1; i < p1.m_path.size(); i++) {
-        if(p1.m_path[i].radius)
-            assert(is_approx(Geometry::ArcWelder::segment_length<coordf_t>(p1.m_path[i-1], p1.m_path[i]), p1.m_path[i].length, EPSILON));
+    for (size_t i = 1; i < p1_path.size(); i++) {
+        if(p1_path[i].radius)
+            assert(is_approx(Geometry::ArcWelder::segment_length<coordf_t>(p1_path[i-1], p1_path[i]), p1_path[i].length, EPSILON));
     }
-    for (size_t i = 1; i < p2.m_path.size(); i++) {
-        if(p2.m_path[i].radius)
-            assert(is_approx(Geometry::ArcWelder::segment_length<coordf_t>(p2.m_path[i-1], p2.m_path[i]), p2.m_path[i].length, EPSILON));
+    for (size_t i = 1; i < p2_path.size(); i++) {
+        if(p2_path[i].radius)
+            assert(is_approx(Geometry::ArcWelder::segment_length<coordf_t>(p2_path[i-1], p2_path[i]), p2_path[i].length, EPSILON));
     }
 #endif
+    p1.set_path(p1_path);
+    p2.set_path(p2_path);
     assert(p1.is_valid());
     assert(p2.is_valid());
     assert(is_approx(this->length(), p1.length() + p2.length(), coordf_t(SCALED_EPSILON)));
@@ -1039,17 +1131,17 @@ void ArcPolyline::split_at(coordf_t distance, ArcPolyline &p1, ArcPolyline &p2)
 
 void ArcPolyline::split_at(Point &point, ArcPolyline &p1, ArcPolyline &p2) const
 {
-    if (this->m_path.empty())
+    if (this->m_points.empty())
         return;
 
-    if (this->size() < 2 || this->m_path.back().point.coincides_with_epsilon(point)) {
+    if (this->size() < 2 || this->back().coincides_with_epsilon(point)) {
         p1 = *this;
         p2.clear();
         return;
     }
     assert(this->is_valid());
 
-    if (this->m_path.front().point.coincides_with_epsilon(point)) {
+    if (this->front().coincides_with_epsilon(point)) {
         p1.clear();
         p1.append(point);
         p2 = *this;
@@ -1066,110 +1158,112 @@ void ArcPolyline::split_at(Point &point, ArcPolyline &p1, ArcPolyline &p2) const
     }
 
     //find the line to split at
-    Geometry::ArcWelder::PathSegmentProjection result = Geometry::ArcWelder::point_to_path_projection(m_path, point);
-    assert(result.segment_id + 1 < this->m_path.size());
-    assert(result.center != Point(0, 0) || this->m_path[result.segment_id + 1].radius == 0); // if no radius, then no center
-    assert(result.center == Point(0, 0) || this->m_path[result.segment_id + 1].radius != 0); // if center defined, then the radius isn't null
-    // the point to add is between m_path[result.segment_id] and m_path[result.segment_id + 1]
+    const Geometry::ArcWelder::Path path = this->get_arc();
+    Geometry::ArcWelder::PathSegmentProjection result = Geometry::ArcWelder::point_to_path_projection(path, point);
+    assert(result.segment_id + 1 < path.size());
+    assert(result.center != Point(0, 0) || path[result.segment_id + 1].radius == 0); // if no radius, then no center
+    assert(result.center == Point(0, 0) || path[result.segment_id + 1].radius != 0); // if center defined, then the radius isn't null
+    // the point to add is between path[result.segment_id] and path[result.segment_id + 1]
     //split and update point
-    p1.clear();
-    p1.m_path.reserve(result.segment_id + 2);
-    p1.m_path.insert(p1.m_path.begin(), this->m_path.begin(), this->m_path.begin() + result.segment_id + 2);
-    p1.m_path.back().point = result.point;
-    if (p1.m_path.back().radius < 0) {
+    Geometry::ArcWelder::Path p1_path;
+    p1_path.reserve(result.segment_id + 2);
+    p1_path.insert(p1_path.begin(), path.begin(), path.begin() + result.segment_id + 2);
+    p1_path.back().point = result.point;
+    if (p1_path.back().radius < 0) {
         //check if the direction isn't reversed because of the smaller angle
-        Point previous_center = Geometry::ArcWelder::arc_center_scalar(this->m_path[result.segment_id].point,
-                                                               this->m_path[result.segment_id + 1].point,
-                                                               this->m_path[result.segment_id + 1].radius,
-                                                               this->m_path[result.segment_id + 1].ccw());
-        assert(p1.m_path.size() == result.segment_id + 2);
-        Point new_center = Geometry::ArcWelder::arc_center_scalar(p1.m_path[result.segment_id].point,
-                                                               p1.m_path[result.segment_id + 1].point,
-                                                               p1.m_path[result.segment_id + 1].radius,
-                                                               p1.m_path[result.segment_id + 1].ccw());
-        Point new_center2 = Geometry::ArcWelder::arc_center_scalar(p1.m_path[result.segment_id].point,
-                                                               p1.m_path[result.segment_id + 1].point,
-                                                               p1.m_path[result.segment_id + 1].radius,
-                                                               !p1.m_path[result.segment_id + 1].ccw());
+        Point previous_center = Geometry::ArcWelder::arc_center_scalar(path[result.segment_id].point,
+                                                               path[result.segment_id + 1].point,
+                                                               path[result.segment_id + 1].radius,
+                                                               path[result.segment_id + 1].ccw());
+        assert(p1_path.size() == result.segment_id + 2);
+        Point new_center = Geometry::ArcWelder::arc_center_scalar(p1_path[result.segment_id].point,
+                                                               p1_path[result.segment_id + 1].point,
+                                                               p1_path[result.segment_id + 1].radius,
+                                                               p1_path[result.segment_id + 1].ccw());
+        Point new_center2 = Geometry::ArcWelder::arc_center_scalar(p1_path[result.segment_id].point,
+                                                               p1_path[result.segment_id + 1].point,
+                                                               p1_path[result.segment_id + 1].radius,
+                                                               !p1_path[result.segment_id + 1].ccw());
         if (previous_center.distance_to_square(new_center) > previous_center.distance_to_square(new_center2)) {
-            p1.m_path.back().radius = (-p1.m_path.back().radius);
+            p1_path.back().radius = (-p1_path.back().radius);
         }
     }
 #ifdef _DEBUG
-    p1.m_path.back().length = Geometry::ArcWelder::segment_length<coordf_t>(p1.m_path[p1.m_path.size()-2], p1.m_path.back());
+    p1_path.back().length = Geometry::ArcWelder::segment_length<coordf_t>(p1_path[p1_path.size()-2], p1_path.back());
 #endif
-    p1.m_only_strait       = not_arc(p1);
-    p2.clear();
-    p2.m_path.reserve(this->size() - result.segment_id);
-    p2.m_path.insert(p2.m_path.begin(), this->m_path.begin() + result.segment_id, this->m_path.end());
-    p2.m_path.front().point  = result.point;
-    p2.m_path.front().radius = 0; // first point can't be an arc
-    p2.m_path.front().orientation = Geometry::ArcWelder::Orientation::Unknown;
-    if (p2.m_path[1].radius < 0) {
-        Point previous_center = Geometry::ArcWelder::arc_center_scalar(this->m_path[result.segment_id].point,
-                                                               this->m_path[result.segment_id + 1].point,
-                                                               this->m_path[result.segment_id + 1].radius,
-                                                               this->m_path[result.segment_id + 1].ccw());
-        assert(p1.m_path.size() > 1);
-        Point new_center = Geometry::ArcWelder::arc_center_scalar(p2.m_path[0].point,
-                                                               p2.m_path[1].point,
-                                                               p2.m_path[1].radius,
-                                                               p2.m_path[1].ccw());
-        Point new_center2 = Geometry::ArcWelder::arc_center_scalar(p2.m_path[0].point,
-                                                               p2.m_path[1].point,
-                                                               p2.m_path[1].radius,
-                                                               !p2.m_path[1].ccw());
+    Geometry::ArcWelder::Path p2_path;
+    p2_path.reserve(this->size() - result.segment_id);
+    p2_path.insert(p2_path.begin(), path.begin() + result.segment_id, path.end());
+    p2_path.front().point  = result.point;
+    p2_path.front().radius = 0; // first point can't be an arc
+    p2_path.front().orientation = Geometry::ArcWelder::Orientation::Unknown;
+    if (p2_path[1].radius < 0) {
+        Point previous_center = Geometry::ArcWelder::arc_center_scalar(path[result.segment_id].point,
+                                                               path[result.segment_id + 1].point,
+                                                               path[result.segment_id + 1].radius,
+                                                               path[result.segment_id + 1].ccw());
+        assert(p1_path.size() > 1);
+        Point new_center = Geometry::ArcWelder::arc_center_scalar(p2_path[0].point,
+                                                               p2_path[1].point,
+                                                               p2_path[1].radius,
+                                                               p2_path[1].ccw());
+        Point new_center2 = Geometry::ArcWelder::arc_center_scalar(p2_path[0].point,
+                                                               p2_path[1].point,
+                                                               p2_path[1].radius,
+                                                               !p2_path[1].ccw());
         if (previous_center.distance_to_square(new_center) > previous_center.distance_to_square(new_center2)) {
-            p2.m_path[1].radius = (-p2.m_path[1].radius);
+            p2_path[1].radius = (-p2_path[1].radius);
         }
     }
 #ifdef _DEBUG
-    p2.m_path[1].length = Geometry::ArcWelder::segment_length<coordf_t>(p2.m_path[0], p2.m_path[1]);
+    p2_path[1].length = Geometry::ArcWelder::segment_length<coordf_t>(p2_path[0], p2_path[1]);
 #endif
-    p2.m_only_strait         = not_arc(p2);
 
     point = result.point;
 
-    if (p1.m_path[p1.size() - 2].point.coincides_with_epsilon(p1.m_path.back().point)) {
-        if (p1.m_path.back().radius == 0 ||
-            Geometry::ArcWelder::arc_length(p1.m_path[p1.size() - 2].point, p1.m_path.back().point,
-                                            p1.m_path.back().radius)) {
+    if (p1_path[p1_path.size() - 2].point.coincides_with_epsilon(p1_path.back().point)) {
+        if (p1_path.back().radius == 0 ||
+            Geometry::ArcWelder::arc_length(p1_path[p1_path.size() - 2].point, p1_path.back().point,
+                                            p1_path.back().radius)) {
             // too close to each other
-            if (p1.m_path.size() == 2) {
-                if (!p2.empty()) {
+            if (p1_path.size() == 2) {
+                if (!p2_path.empty()) {
                     // clear first polyline
-                    p2.set_front(p1.front());
-                    p1.clear();
+                    p2_path.front().point = p1_path.front().point;
+                    p2_path[1] = Geometry::ArcWelder::Segment(p2_path[1].point);
+                    p1_path.clear();
                 } else {
                     assert(false);
                 }
             } else {
                 // remove last segment, keep last point
-                p1.m_path[p1.size() - 2].point = p1.m_path.back().point;
-                p1.m_path.pop_back();
+                p1_path[p1_path.size() - 2].point = p1_path.back().point;
+                p1_path.pop_back();
             }
         }
     }
-    if (p2.m_path.front().point.coincides_with_epsilon(p2.m_path[1].point)) {
-        if (p2.m_path[1].radius == 0 ||
-            Geometry::ArcWelder::arc_length(p2.m_path.front().point, p2.m_path[1].point,
-                                            p2.m_path[1].radius)) {
+    if (p2_path.front().point.coincides_with_epsilon(p2_path[1].point)) {
+        if (p2_path[1].radius == 0 ||
+            Geometry::ArcWelder::arc_length(p2_path.front().point, p2_path[1].point,
+                                            p2_path[1].radius)) {
             // too close to each other
-            if (p2.m_path.size() == 2) {
-                if (!p2.empty()) {
+            if (p2_path.size() == 2) {
+                if (!p2_path.empty()) {
                     // clear first polyline
-                    p1.set_back(p2.back());
-                    p2.clear();
+                    p1_path.back() = Geometry::ArcWelder::Segment(p2_path.back().point);
+                    p2_path.clear();
                 } else {
                     assert(false);
                 }
             } else {
                 // remove first segment, keep first point
-                p2.m_path.erase(p2.m_path.begin() + 1);
+                p2_path.erase(p2_path.begin() + 1);
             }
         }
     }
 
+    p1.set_path(p1_path);
+    p2.set_path(p2_path);
     assert(p1.is_valid());
     assert(p2.is_valid());
     assert(p1.front() == this->front());
@@ -1185,18 +1279,27 @@ bool ArcPolyline::split_at_index(const size_t index, ArcPolyline &p1, ArcPolylin
         p1.append(this->front());
         p2 = *this;
     } else if (index == this->size() - 1) {
-        p2.m_path.insert(p2.m_path.begin(), Geometry::ArcWelder::Segment{this->back(), 0.f, Geometry::ArcWelder::Orientation::Unknown});
+        p2.append_before(this->back());
         p1 = *this;
     } else {
-        p1.m_path.reserve(p1.m_path.size() + index + 1);
-        p1.m_path.insert(p1.m_path.end(), this->m_path.begin(), this->m_path.begin() + index + 1);
-        p1.m_only_strait = not_arc(p1);
-
-        p2.m_path.reserve(p2.m_path.size() + this->size() - index);
-        p2.m_path.insert(p2.m_path.begin(), this->m_path.begin() + index, this->m_path.end());
-        p2.m_path.front().radius = 0; // first point can't be an arc
-        p2.m_path.front().orientation = Geometry::ArcWelder::Orientation::Unknown;
-        p2.m_only_strait         = not_arc(p2);
+        // arcs ending at index or before are in p1, the others are in p2 (first point can't be an arc)
+        auto it_split = std::upper_bound(m_arcs.begin(), m_arcs.end(), index,
+                                         [](size_t i, const ArcSegment &arc) { return i < arc.index; });
+
+        const size_t p1_offset = p1.m_points.size();
+        p1.m_points.insert(p1.m_points.end(), this->m_points.begin(), this->m_points.begin() + index + 1);
+        for (auto it = m_arcs.begin(); it != it_split; ++it)
+            p1.m_arcs.push_back({it->index + p1_offset, it->radius, it->orientation});
+
+        for (ArcSegment &arc : p2.m_arcs)
+            arc.index += this->size() - index;
+        p2.m_points.insert(p2.m_points.begin(), this->m_points.begin() + index, this->m_points.end());
+        std::vector<ArcSegment> p2_arcs;
+        p2_arcs.reserve(size_t(m_arcs.end() - it_split) + p2.m_arcs.size());
+        for (auto it = it_split; it != m_arcs.end(); ++it)
+            p2_arcs.push_back({it->index - index, it->radius, it->orientation});
+        p2_arcs.insert(p2_arcs.end(), p2.m_arcs.begin(), p2.m_arcs.end());
+        p2.m_arcs = std::move(p2_arcs);
     }
     return true;
 }
@@ -1204,28 +1307,28 @@ bool ArcPolyline::split_at_index(const size_t index, ArcPolyline &p1, ArcPolylin
 //TODO: find a way to avoid duplication of get_point_from_end / get_point_from_begin
 Point ArcPolyline::get_point_from_begin(coord_t distance) const {
     size_t idx = 1;
-    while (distance > 0 && idx < m_path.size()) {
-        const Geometry::ArcWelder::Segment last = m_path[idx - 1];
-        const Geometry::ArcWelder::Segment current = m_path[idx];
+    while (distance > 0 && idx < m_points.size()) {
+        const Point &last = m_points[idx - 1];
+        const Geometry::ArcWelder::Segment current = this->get_arc(idx);
         if (current.linear()) {
             // Linear segment
-            Vec2d  v    = (current.point - last.point).cast<double>();
+            Vec2d  v    = (current.point - last).cast<double>();
             double lsqr = v.squaredNorm();
             if (lsqr >= sqr(distance)) {
                 // Length to go is zero.
-                return last.point + Point::round(v * (distance / sqrt(lsqr)));
+                return last + Point::round(v * (distance / sqrt(lsqr)));
             }
             distance -= sqrt(lsqr);
         } else {
             // Circular segment
-            double angle = Geometry::ArcWelder::arc_angle(last.point.cast<double>(), current.point.cast<double>(), current.radius);
+            double angle = Geometry::ArcWelder::arc_angle(last.cast<double>(), current.point.cast<double>(), current.radius);
             double len   = std::abs(current.radius) * angle;
             if (len >= distance) {
                 // Rotate the segment end point towards the current point.
                 if (current.ccw())
                     angle *= -1.;
-                return last.point.rotated( -angle * (distance / len), Point::round(
-                        Geometry::ArcWelder::arc_center(last.point.cast<double>(), current.point.cast<double>(), double(current.radius), current.ccw())));
+                return last.rotated( -angle * (distance / len), Point::round(
+                        Geometry::ArcWelder::arc_center(last.cast<double>(), current.point.cast<double>(), double(current.radius), current.ccw())));
             }
             distance -= len;
         }
@@ -1234,17 +1337,17 @@ Point ArcPolyline::get_point_from_begin(coord_t distance) const {
 
     // Return remaining distance to go.
     assert(distance >= 0);
-    return m_path[idx - 1].point;
+    return m_points[idx - 1];
 }
 
 Point ArcPolyline::get_point_from_end(coord_t distance) const {
-    size_t idx = m_path.size() - 1;
+    size_t idx = m_points.size() - 1;
     while (distance > 0 && idx > 0) {
-        const Geometry::ArcWelder::Segment last = m_path[idx];
-        const Geometry::ArcWelder::Segment current = m_path[idx - 1];
+        const Geometry::ArcWelder::Segment last = this->get_arc(idx);
+        const Point &current = m_points[idx - 1];
         if (last.linear()) {
             // Linear segment
-            Vec2d  v    = (current.point - last.point).cast<double>();
+            Vec2d  v    = (current - last.point).cast<double>();
             double lsqr = v.squaredNorm();
             if (lsqr >= sqr(distance)) {
                 // Length to go is zero.
@@ -1253,14 +1356,14 @@ Point ArcPolyline::get_point_from_end(coord_t distance) const {
             distance -= sqrt(lsqr);
         } else {
             // Circular segment
-            double angle = Geometry::ArcWelder::arc_angle(current.point.cast<double>(), last.point.cast<double>(), last.radius);
+            double angle = Geometry::ArcWelder::arc_angle(current.cast<double>(), last.point.cast<double>(), last.radius);
             double len   = std::abs(last.radius) * angle;
             if (len >= distance) {
                 // Rotate the segment end point in reverse towards the start point.
                 if (last.ccw())
                     angle *= -1.;
                 return last.point.rotated(angle * (distance / len), Point::round(
-                        Geometry::ArcWelder::arc_center(current.point.cast<double>(), last.point.cast<double>(), double(last.radius), last.ccw())));
+                        Geometry::ArcWelder::arc_center(current.cast<double>(), last.point.cast<double>(), double(last.radius), last.ccw())));
             }
             distance -= len;
         }
@@ -1269,35 +1372,35 @@ Point ArcPolyline::get_point_from_end(coord_t distance) const {
 
     // Return remaining distance to go.
     assert(distance >= 0);
-    return m_path[idx].point;
+    return m_points[idx];
 }
 
 void ArcPolyline::set_front(const Point &p) {
-    assert(!m_path.empty());
-    m_path.front().point = p;
-    if (m_path.size() > 1) {
-        m_path[1].radius = 0.f;
-        m_path[1].orientation = Geometry::ArcWelder::Orientation::Unknown;
-    }
+    assert(!m_points.empty());
+    m_points.front() = p;
+    if (!m_arcs.empty() && m_arcs.front().index == 1)
+        m_arcs.erase(m_arcs.begin());
     assert(is_valid());
 }
 
 void ArcPolyline::set_back(const Point &p) {
-    assert(!m_path.empty());
-    m_path.back().point = p;
-    m_path.back().radius = 0.f;
-    m_path.back().orientation = Geometry::ArcWelder::Orientation::Unknown;
+    assert(!m_points.empty());
+    m_points.back() = p;
+    if (!m_arcs.empty() && m_arcs.back().index + 1 == m_points.size())
+        m_arcs.pop_back();
     assert(is_valid());
 }
 
 Polyline ArcPolyline::to_polyline(coord_t deviation/*=0*/) const {
     Polyline poly_out;
-    if (!empty()) {
-        assert(m_path.front().radius == 0);
-        if (deviation > 0 || m_only_strait || m_path.size() < 2) {
-            assert(m_only_strait == not_arc(*this));
-            for (const Geometry::ArcWelder::Segment &seg : m_path)
-                if (seg.radius == 0 || m_only_strait) {
+    if (!this->has_arc()) {
+        poly_out.points = m_points;
+    } else {
+        const Geometry::ArcWelder::Path path = this->get_arc();
+        assert(path.front().radius == 0);
+        if (deviation > 0 || path.size() < 2) {
+            for (const Geometry::ArcWelder::Segment &seg : path)
+                if (seg.radius == 0) {
                     poly_out.append(seg.point);
                 } else if(deviation == 0) {
                     assert(false);
@@ -1329,7 +1432,7 @@ Polyline ArcPolyline::to_polyline(coord_t deviation/*=0*/) const {
                 }
         } else {
 
-            for (const Geometry::ArcWelder::Segment &seg : m_path) {
+            for (const Geometry::ArcWelder::Segment &seg : path) {
                 if (seg.radius == 0) {
                     assert(poly_out.empty() || !poly_out.back().coincides_with_epsilon(seg.point));
                     poly_out.append(seg.point);
@@ -1361,22 +1464,6 @@ Polyline ArcPolyline::to_polyline(coord_t deviation/*=0*/) const {
 }
 
 
-Geometry::ArcWelder::Path ArcPolyline::_from_polyline(const Points &poly)
-{
-    Geometry::ArcWelder::Path path;
-    for (const Point &point : poly)
-        path.emplace_back(std::move(point), 0, Geometry::ArcWelder::Orientation::Unknown);
-    return path;
-}
-
-Geometry::ArcWelder::Path ArcPolyline::_from_polyline(std::initializer_list<Point> poly)
-{
-    Geometry::ArcWelder::Path path;
-    for (const Point &point : poly)
-        path.emplace_back(std::move(point), 0, Geometry::ArcWelder::Orientation::Unknown);
-    return path;
-}
-
 //TODO: unit tests
 // it will return the size of the buffer still used. It will try to not use d more than half, unless buffer_init < 0, then it will try to not use any at the end.
 //TODO: improvement: instead of watching at three point -> deleting the center (2 instead of 3), look at four -> add center of two center ones -> keep new & start & end (3 instead of 4)
@@ -1389,6 +1476,7 @@ int ArcPolyline::simplify_straits(coordf_t min_tolerance,
 {
     assert(is_valid());
     return 0;
+    Geometry::ArcWelder::Path path = this->get_arc();
     // incentive to remove odds points
     float squew[] = { 1, 0.94f, 0.98f, 0.96f, 0.99f, 0.93f, 0.97f, 0.95f};
 
@@ -1410,7 +1498,7 @@ int ArcPolyline::simplify_straits(coordf_t min_tolerance,
     std::vector<size_t> erased;
 
     idxs.push_back(0);
-    for (size_t idx_end = 1; idx_end < this->m_path.size(); ++idx_end) {
+    for (size_t idx_end = 1; idx_end < path.size(); ++idx_end) {
         assert(current_buffer_size + 1 == idxs.size());
         assert(current_buffer_size == arc.size());
         assert(current_buffer_size == line_length.size());
@@ -1419,8 +1507,8 @@ int ArcPolyline::simplify_straits(coordf_t min_tolerance,
         assert(buffer_length <= min_buffer_length || current_buffer_size <= 1);
 
         // compute max window (smaller at start & end)
-        if (idx_end > this->m_path.size() - buffer_size / 2) {
-            max_buffer_size = max_buffer_size_end + this->m_path.size() - idx_end;
+        if (idx_end > path.size() - buffer_size / 2) {
+            max_buffer_size = max_buffer_size_end + path.size() - idx_end;
             assert(max_buffer_size >= max_buffer_size_end);
             if (idx_end < buffer_size) {
                 max_buffer_size = std::min(max_buffer_size, std::max(buffer_size - max_buffer_size_start, int(idx_end)));
@@ -1432,9 +1520,9 @@ int ArcPolyline::simplify_straits(coordf_t min_tolerance,
         }
 
         // try add a point in the buffer
-        Point new_point = m_path[idx_end].point;
+        Point new_point = path[idx_end].point;
         //TODO better arc (here the length is minimized)
-        coord_t new_seg_length = coord_t(m_path[idxs.back()].point.distance_to(new_point));
+        coord_t new_seg_length = coord_t(path[idxs.back()].point.distance_to(new_point));
         assert(new_seg_length > 0);
 
         // be sure it's not filled
@@ -1451,20 +1539,20 @@ int ArcPolyline::simplify_straits(coordf_t min_tolerance,
             idxs.push_back(idx_end);
             for (size_t i = 0; i < current_buffer_size; ++i) {
 //#ifdef _DEBUG
-//                    Point previous = m_path[idxs[i]].point;
-//                    Point current = m_path[idxs[i+1]].point;
-//                    Point next = m_path[idxs[i+2]].point;
+//                    Point previous = path[idxs[i]].point;
+//                    Point current = path[idxs[i+1]].point;
+//                    Point next = path[idxs[i+2]].point;
 //                    length.resize(current_buffer_size);
 //                    length[i] = previous.distance_to(current) + current.distance_to(next);
 //#endif
                 if (weights[i] < 0) {
                     //compute weight : 0 is 'no not remove'. 1 is 'remove this first'
                     assert(idxs.size() > i+2);
-                    assert(m_path.size() > idxs[i+2]);
+                    assert(path.size() > idxs[i+2]);
                     //Get previous & next point
-                    Point previous = m_path[idxs[i]].point;
-                    Point current = m_path[idxs[i+1]].point;
-                    Point next = m_path[idxs[i+2]].point;
+                    Point previous = path[idxs[i]].point;
+                    Point current = path[idxs[i+1]].point;
+                    Point next = path[idxs[i+2]].point;
                     // check deviation
                     coordf_t deviation = Line::distance_to(current, previous, next);
                     if (deviation > min_tolerance) {
@@ -1517,8 +1605,8 @@ int ArcPolyline::simplify_straits(coordf_t min_tolerance,
             // recompute next point things
             if (worst_idx < current_buffer_size) {
                 // recompute length from previous point
-                Point previous = m_path[worst_idx].point;
-                Point next = m_path[worst_idx + 1].point;
+                Point previous = path[worst_idx].point;
+                Point next = path[worst_idx + 1].point;
                 buffer_length -= line_length[worst_idx];
                 line_length[worst_idx] = previous.distance_to(next);
                 buffer_length += line_length[worst_idx];
@@ -1538,7 +1626,7 @@ int ArcPolyline::simplify_straits(coordf_t min_tolerance,
         if (current_buffer_size > 0 && arc.back() == 0 && 
             min_point_distance > line_length.back() && min_point_distance > new_seg_length
             // also make sure it's not an important point for a ponty tip.
-            && new_seg_length < m_path[idxs[idxs.size() - 2]].point.distance_to(new_point)
+            && new_seg_length < path[idxs[idxs.size() - 2]].point.distance_to(new_point)
             ) {
             // erase previous point
             erased.push_back(idxs.back());
@@ -1549,7 +1637,7 @@ int ArcPolyline::simplify_straits(coordf_t min_tolerance,
             assert(weights.back() > 0);
             weights.pop_back();
             --current_buffer_size;
-            new_seg_length = coord_t(m_path[idxs.back()].point.distance_to(new_point));
+            new_seg_length = coord_t(path[idxs.back()].point.distance_to(new_point));
             assert(new_seg_length > 0);
         }
 
@@ -1558,10 +1646,10 @@ int ArcPolyline::simplify_straits(coordf_t min_tolerance,
         idxs.push_back(idx_end);
         line_length.push_back(new_seg_length);
         buffer_length += new_seg_length;
-        bool previous_is_arc = m_path[idx_end -1].radius != 0;
+        bool previous_is_arc = path[idx_end -1].radius != 0;
         if(previous_is_arc)
             assert(arc.empty() || arc.back() == 1);
-        if (m_path[idx_end].radius == 0) {
+        if (path[idx_end].radius == 0) {
             arc.push_back(previous_is_arc ? 2 : 0);
         } else {
             if (!previous_is_arc && !arc.empty()) {
@@ -1602,8 +1690,8 @@ int ArcPolyline::simplify_straits(coordf_t min_tolerance,
     //remove points
     if (erased.size() < 5) {
         for (size_t idx_to_erase = erased.size() - 1; idx_to_erase < erased.size(); --idx_to_erase) {
-            assert(erased[idx_to_erase] < this->m_path.size());
-            this->m_path.erase(this->m_path.begin() + erased[idx_to_erase]);
+            assert(erased[idx_to_erase] < path.size());
+            path.erase(path.begin() + erased[idx_to_erase]);
         }
     } else {
         assert(!erased.empty());
@@ -1611,16 +1699,17 @@ int ArcPolyline::simplify_straits(coordf_t min_tolerance,
         Geometry::ArcWelder::Path new_path;
         size_t erased_idx = 0;
         size_t next_erased = erased[erased_idx];
-        erased.push_back(m_path.size());
-        for (size_t i = 0; i < m_path.size(); i++) {
+        erased.push_back(path.size());
+        for (size_t i = 0; i < path.size(); i++) {
             if (next_erased == i) {
                 next_erased = erased[++erased_idx];
             } else {
-                new_path.push_back(std::move(m_path[i]));
+                new_path.push_back(std::move(path[i]));
             }
         }
-        m_path = std::move(new_path);
+        path = std::move(new_path);
     }
+    this->set_path(path);
     
     assert(is_valid());
     //at the end, we should have the buffer no more than 1/2 filled.
@@ -1636,20 +1725,20 @@ void ArcPolyline::simplify_straits(const coordf_t min_tolerance,
     //use a window of buffer size.
     const coord_t min_point_distance_sqr = min_point_distance * min_point_distance;
 
-    for (size_t idx_pt = 1; idx_pt < this->m_path.size() - 1; ++idx_pt) {
+    for (size_t idx_pt = 1; idx_pt < this->m_points.size() - 1; ++idx_pt) {
         // only erase point between two strait segment
-        if (m_path[idx_pt].radius == 0 && m_path[idx_pt + 1].radius == 0) {
+        if (this->find_arc(idx_pt) == nullptr && this->find_arc(idx_pt + 1) == nullptr) {
             // Get previous & next point
-            Point previous = m_path[idx_pt - 1].point;
-            Point current = m_path[idx_pt].point;
-            Point next = m_path[idx_pt + 1].point;
+            Point previous = m_points[idx_pt - 1];
+            Point current = m_points[idx_pt];
+            Point next = m_points[idx_pt + 1];
             // check deviation
             coordf_t deviation = Line::distance_to(current, previous, next);
             //if deviation is small enough and the distance is too small
             if (deviation < min_tolerance &&
                 (min_point_distance_sqr < previous.distance_to_square(current) ||
                  min_point_distance_sqr < current.distance_to_square(next))) {
-                m_path.erase(m_path.begin() + idx_pt);
+                this->erase_point(idx_pt);
             }
         }
     }
@@ -1661,25 +1750,26 @@ void ArcPolyline::simplify_straits(const coordf_t min_tolerance,
 // douglas_peuker and create arc if with_fitting_arc
 void ArcPolyline::make_arc(ArcFittingType with_fitting_arc, coordf_t tolerance, double fit_percent_tolerance)
 {
-    if (with_fitting_arc != ArcFittingType::Disabled && m_path.size() > 2) {
+    if (with_fitting_arc != ArcFittingType::Disabled && m_points.size() > 2) {
+        const Geometry::ArcWelder::Path src_path = this->get_arc();
         // BBS: do arc fit first, then use DP simplify to handle the straight part to reduce point.
         Points pts;
         Geometry::ArcWelder::Path path;
         // do only section without arcs
         size_t idx_end_mpath;
-        path.push_back(m_path.front());
-        pts.push_back(m_path.front().point);
+        path.push_back(src_path.front());
+        pts.push_back(src_path.front().point);
         assert(path.empty() || path.front().radius == 0);
-        for (idx_end_mpath = 1; idx_end_mpath < m_path.size(); ++idx_end_mpath) {
-            if (m_path[idx_end_mpath].radius == 0) {
-                assert(pts.empty() || !pts.back().coincides_with_epsilon(m_path[idx_end_mpath].point));
-                pts.push_back(m_path[idx_end_mpath].point);
+        for (idx_end_mpath = 1; idx_end_mpath < src_path.size(); ++idx_end_mpath) {
+            if (src_path[idx_end_mpath].radius == 0) {
+                assert(pts.empty() || !pts.back().coincides_with_epsilon(src_path[idx_end_mpath].point));
+                pts.push_back(src_path[idx_end_mpath].point);
             }
             // if current point is arc, make arc on the strait section before it (if enough points)
             // or if it's the last point of the path, do it on the last strait section (if enough points)
-            if (m_path[idx_end_mpath].radius != 0 || idx_end_mpath + 1 >= m_path.size()) {
+            if (src_path[idx_end_mpath].radius != 0 || idx_end_mpath + 1 >= src_path.size()) {
                 for(int ii=1;ii<pts.size();++ii) assert(!pts[ii-1].coincides_with_epsilon(pts[ii]));
-                assert(m_path[idx_end_mpath].radius == 0 || !pts.back().coincides_with_epsilon(m_path[idx_end_mpath].point));
+                assert(src_path[idx_end_mpath].radius == 0 || !pts.back().coincides_with_epsilon(src_path[idx_end_mpath].point));
                 // less than 3 points: don't use
                 if (pts.size() > 2) {
                     // remove strait sections
@@ -1747,15 +1837,6 @@ void ArcPolyline::make_arc(ArcFittingType with_fitting_arc, coordf_t tolerance,
                             }
                         }
                         assert(path.empty() || path.front().radius == 0);
-#if _DEBUG
-                        for (size_t i = 1; i < m_path.size(); ++i) {
-                            Geometry::ArcWelder::Segment &seg = m_path[i];
-                            if (seg.radius) {
-                                seg.length = Geometry::ArcWelder::segment_length<coordf_t>(m_path[i - 1], seg);
-                                seg.center = Geometry::ArcWelder::arc_center_scalar(m_path[i - 1].point, seg.point, seg.radius, seg.ccw());
-                            }
-                        }
-#endif
                     } else /* if (with_fitting_arc == ArcFittingType::ArcWelder)*/ {
                         // === use ArcWelder ===
                         Geometry::ArcWelder::Path result = Geometry::ArcWelder::fit_path(pts, tolerance, fit_percent_tolerance);
@@ -1790,7 +1871,7 @@ void ArcPolyline::make_arc(ArcFittingType with_fitting_arc, coordf_t tolerance,
                         }
                         assert(path.empty() || path.front().radius == 0);
                     }
-                    //assert(idx_end_mpath > 0 && m_path[idx_end_mpath].point == path.back().point);
+                    //assert(idx_end_mpath > 0 && src_path[idx_end_mpath].point == path.back().point);
                 } else {
                     // add strait
                     assert(path.empty() || path.back().point.coincides_with_epsilon(pts.front()));
@@ -1799,25 +1880,29 @@ void ArcPolyline::make_arc(ArcFittingType with_fitting_arc, coordf_t tolerance,
                 }
                 }
                 assert(path.back().point == pts.back());
-                if (m_path[idx_end_mpath].radius != 0) {
+                if (src_path[idx_end_mpath].radius != 0) {
                     // add arc
-                    path.push_back(m_path[idx_end_mpath]);
+                    path.push_back(src_path[idx_end_mpath]);
                 }
                 pts.clear();
                 pts.push_back(path.back().point);
             }
         }
         // copy new path (may be the same)
-        assert(m_path.front().point == path.front().point && m_path.back().point == path.back().point);
-        m_path = path;
-        this->m_only_strait = not_arc(*this);
+        assert(src_path.front().point == path.front().point && src_path.back().point == path.back().point);
+        this->set_path(path);
         assert(is_valid());
     } else {
-        auto it_end = douglas_peucker<double>(this->m_path.begin(), this->m_path.end(), this->m_path.begin(), tolerance,
-                                        [](const Geometry::ArcWelder::Segment &s) { return s.point; });
-        if (it_end != this->m_path.end()) {
-            size_t new_size = size_t(it_end-this->m_path.begin());
-            this->m_path.resize(size_t(it_end - this->m_path.begin()));
+        if (!this->has_arc()) {
+            auto it_end = douglas_peucker<double>(this->m_points.begin(), this->m_points.end(), this->m_points.begin(), tolerance,
+                                            [](const Point &p) { return p; });
+            this->m_points.resize(size_t(it_end - this->m_points.begin()));
+        } else {
+            Geometry::ArcWelder::Path path = this->get_arc();
+            auto it_end = douglas_peucker<double>(path.begin(), path.end(), path.begin(), tolerance,
+                                            [](const Geometry::ArcWelder::Segment &s) { return s.point; });
+            path.resize(size_t(it_end - path.begin()));
+            this->set_path(path);
         }
         assert(is_valid());
     }
@@ -1825,43 +1910,43 @@ void ArcPolyline::make_arc(ArcFittingType with_fitting_arc, coordf_t tolerance,
 
 bool ArcPolyline::is_valid() const {
 #ifdef _DEBEUG
-    assert(m_path.empty() || m_path.front().radius == 0);
+    const Geometry::ArcWelder::Path path = this->get_arc();
+    assert(path.empty() || path.front().radius == 0);
     double min_radius = 0;
     double max_radius = 0;
     Point first_center;
-    for (size_t i = 1; i < m_path.size(); ++i) {
+    for (size_t i = 1; i < path.size(); ++i) {
         if(!this->is_3D)
-            assert(!m_path[i - 1].point.coincides_with_epsilon(m_path[i].point));
-        if (m_path[i].radius != 0) {
-            Vec2d center = Slic3r::Geometry::ArcWelder::arc_center(m_path[i-1].point.cast<coordf_t>(), m_path[i].point.cast<coordf_t>(), coordf_t(m_path[i].radius), m_path[i].ccw());
-            double angle = Slic3r::Geometry::ArcWelder::arc_angle(m_path[i-1].point.cast<coordf_t>(), m_path[i].point.cast<coordf_t>(), coordf_t(m_path[i].radius));
-            double ccw_angle = angle_ccw(m_path[i-1].point.cast<coordf_t>() - center, m_path[i].point.cast<coordf_t>()   - center);
-            if (!m_path[i].ccw())
+            assert(!path[i - 1].point.coincides_with_epsilon(path[i].point));
+        if (path[i].radius != 0) {
+            Vec2d center = Slic3r::Geometry::ArcWelder::arc_center(path[i-1].point.cast<coordf_t>(), path[i].point.cast<coordf_t>(), coordf_t(path[i].radius), path[i].ccw());
+            double angle = Slic3r::Geometry::ArcWelder::arc_angle(path[i-1].point.cast<coordf_t>(), path[i].point.cast<coordf_t>(), coordf_t(path[i].radius));
+            double ccw_angle = angle_ccw(path[i-1].point.cast<coordf_t>() - center, path[i].point.cast<coordf_t>()   - center);
+            if (!path[i].ccw())
                 ccw_angle = (-ccw_angle);
             if (ccw_angle < 0)
                 ccw_angle = 2 * PI + ccw_angle;
             assert(is_approx(ccw_angle, angle, EPSILON));
-            coordf_t new_length = Slic3r::Geometry::ArcWelder::arc_length(m_path[i - 1].point, m_path[i].point, coordf_t(m_path[i].radius));
-            //coordf_t new_length2 = Slic3r::Geometry::ArcWelder::arc_length<Point,Point,Point,coordf_t>(m_path[i - 1].point, m_path[i].point, Point::round(center), m_path[i].ccw());
-            Vec2d startd = m_path[i - 1].point.cast<double>();
-            Vec2d endd = m_path[i].point.cast<double>();
-            coordf_t new_length2 = Geometry::ArcWelder::arc_length<Vec2d,Vec2d,Vec2d,double>(startd, endd, center, m_path[i].ccw());
-            Vec2d centerd = m_path[i].center.cast<double>();
-            coordf_t new_length3 = Geometry::ArcWelder::arc_length<Vec2d,Vec2d,Vec2d,double>(startd, endd, centerd, m_path[i].ccw());
+            coordf_t new_length = Slic3r::Geometry::ArcWelder::arc_length(path[i - 1].point, path[i].point, coordf_t(path[i].radius));
+            //coordf_t new_length2 = Slic3r::Geometry::ArcWelder::arc_length<Point,Point,Point,coordf_t>(path[i - 1].point, path[i].point, Point::round(center), path[i].ccw());
+            Vec2d startd = path[i - 1].point.cast<double>();
+            Vec2d endd = path[i].point.cast<double>();
+            coordf_t new_length2 = Geometry::ArcWelder::arc_length<Vec2d,Vec2d,Vec2d,double>(startd, endd, center, path[i].ccw());
+            Vec2d centerd = path[i].center.cast<double>();
+            coordf_t new_length3 = Geometry::ArcWelder::arc_length<Vec2d,Vec2d,Vec2d,double>(startd, endd, centerd, path[i].ccw());
             assert(is_approx(new_length, new_length2, SCALED_EPSILON*4.));
             assert(is_approx(new_length2, new_length3, SCALED_EPSILON*10.));
-            assert(is_approx(new_length2, m_path[i].length, SCALED_EPSILON*2.));
-            Slic3r::Geometry::ArcWelder::Orientation orientation = Slic3r::Geometry::ArcWelder::arc_orientation(m_path[i - 1].point, m_path[i].point, m_path[i].center, m_path[i].radius);
-            assert(orientation == m_path[i].orientation);
-            Slic3r::Geometry::ArcWelder::Orientation orientation2 = Slic3r::Geometry::ArcWelder::arc_orientation(m_path[i - 1].point, m_path[i].point, Point::round(center), m_path[i].radius);
-            assert(is_approx(coord_t(center.x()), m_path[i].center.x(), coord_t(std::abs(m_path[i].radius / 100))));
-            assert(is_approx(coord_t(center.y()), m_path[i].center.y(), coord_t(std::abs(m_path[i].radius / 100))));
+            assert(is_approx(new_length2, path[i].length, SCALED_EPSILON*2.));
+            Slic3r::Geometry::ArcWelder::Orientation orientation = Slic3r::Geometry::ArcWelder::arc_orientation(path[i - 1].point, path[i].point, path[i].center, path[i].radius);
+            assert(orientation == path[i].orientation);
+            Slic3r::Geometry::ArcWelder::Orientation orientation2 = Slic3r::Geometry::ArcWelder::arc_orientation(path[i - 1].point, path[i].point, Point::round(center), path[i].radius);
+            assert(is_approx(coord_t(center.x()), path[i].center.x(), coord_t(std::abs(path[i].radius / 100))));
+            assert(is_approx(coord_t(center.y()), path[i].center.y(), coord_t(std::abs(path[i].radius / 100))));
         }
         //assert(std::abs(max_radius - min_radius) <= std::abs(max_radius) * 0.01);
     }
-    assert(not_arc(*this) == m_only_strait);
 #endif
-    return m_path.size() >= 2;
+    return m_points.size() >= 2;
 }
 
 // return false if the length of this path is (now) too short. 
@@ -1890,13 +1975,13 @@ bool ArcPolyline::normalize() {
                 if (dist_before_sqr < dist_after_sqr) {
                     // remove curr
                     assert(i_pt >= 0 && i_pt < size());
-                    m_path.erase(m_path.begin() + i_pt);
+                    this->erase_point(i_pt);
                     --i_pt;
                     curr = prev;
                 } else {
                     // remove next
                     assert(i_pt + 1 >= 0 && i_pt + 1 < size());
-                    m_path.erase(m_path.begin() + i_pt + 1);
+                    this->erase_point(i_pt + 1);
                     --i_pt;
                     next = curr;
                     curr = prev;
@@ -288,18 +288,27 @@ typedef std::vector<Polyline3> Polylines3;
 class ArcPolyline
 {
 protected:
-    // each segment is strait if it's radius ==0 (orientation should be unknown in this case)
+    // Arc of the segment ending at m_points[index], the segments without an entry in m_arcs are strait.
     // radius is negative if the arc betweent he two point is the longest of the two. it's positive if it's the shortest.
     // the sign of the radius and the orientation are two different way to get the same information. They MUST be in synch.
-    // note: first Segment in Path is always "strait", as it's the starting point of the following segment. 
-    Geometry::ArcWelder::Path m_path;
-    //bool cache_valid = true; // cache
-    bool m_only_strait = true; // cache
-    //note: i don't keep the polyline, as it's easy to reconstruct from arc (to_polyline).
-    // if it creates a big preformance problem, then add a cache here.
-
-    static Geometry::ArcWelder::Path _from_polyline(const Points &poly);
-    static Geometry::ArcWelder::Path _from_polyline(std::initializer_list<Point> poly);
+    struct ArcSegment
+    {
+        size_t                           index;
+        float                            radius;
+        Geometry::ArcWelder::Orientation orientation;
+    };
+    // Most of the paths have no arc at all: the points are stored as a plain Points, and the arcs in a sparse table
+    // sorted by index. The Geometry::ArcWelder::Path is only built on demand by get_arc().
+    // note: first point is never the end of an arc, as it's the starting point of the following segment.
+    Points                  m_points;
+    std::vector<ArcSegment> m_arcs;
+
+    // Arc ending at point idx, nullptr if the segment is strait.
+    const ArcSegment *find_arc(size_t idx) const;
+    // Remove the point idx, the segment ending at the next point starts from the previous one.
+    void erase_point(size_t idx);
+    void set_path(const Geometry::ArcWelder::Path &path);
+
 public:
 #ifdef _DEBUG
     bool is_3D = false; // to deactivate assert about epsilon dist
@@ -307,39 +316,40 @@ public:
     ArcPolyline(){};
     ArcPolyline(const ArcPolyline &) = default;
     ArcPolyline(ArcPolyline &&)      = default;
-    ArcPolyline(const Polyline &other) : m_path(_from_polyline(other.points)) {}
-    ArcPolyline(const Points &other) : m_path(_from_polyline(other)) {}
-    ArcPolyline(const Geometry::ArcWelder::Path &other);
+    ArcPolyline(const Polyline &other) : m_points(other.points) {}
+    ArcPolyline(const Points &other) : m_points(other) {}
+    ArcPolyline(const Geometry::ArcWelder::Path &other) { this->set_path(other); }
     ArcPolyline &operator=(const ArcPolyline &) = default;
     ArcPolyline &operator=(ArcPolyline &&) = default;
 
-    void append(const Point &point) { m_path.emplace_back(Geometry::ArcWelder::Segment{point, 0.f, Geometry::ArcWelder::Orientation::Unknown}); }
-    void append_before(const Point &point) { m_path.insert(m_path.begin(), Geometry::ArcWelder::Segment{point, 0.f, Geometry::ArcWelder::Orientation::Unknown}); }
+    void append(const Point &point) { m_points.push_back(point); }
+    void append_before(const Point &point);
     void append(const Points &src);
     void append(Points &&src);
     void append(const Points::const_iterator &begin, const Points::const_iterator &end);
     void append(const ArcPolyline &src);
     void append(const Geometry::ArcWelder::Segment &arc);
     void append(ArcPolyline &&src);
-    void clear();
-    void swap(ArcPolyline &other) { m_path.swap(other.m_path); this->m_only_strait = other.m_only_strait; assert(is_valid()); }
-    void reverse() { Geometry::ArcWelder::reverse(m_path); }
+    void clear() { m_points.clear(); m_arcs.clear(); }
+    void swap(ArcPolyline &other) { m_points.swap(other.m_points); m_arcs.swap(other.m_arcs); assert(is_valid()); }
+    void reverse();
     
     // multipoint methods
-    const Point &front() const { return m_path.front().point; }
-    const Point &middle() const { return m_path[m_path.size() / 2].point; }
-    const Point &back() const { return m_path.back().point; }
-    bool         empty() const { return m_path.empty(); }
+    const Point &front() const { return m_points.front(); }
+    const Point &middle() const { return m_points[m_points.size() / 2]; }
+    const Point &back() const { return m_points.back(); }
+    bool         empty() const { return m_points.empty(); }
     bool         is_valid() const;
-    bool         is_closed() const { return this->m_path.front().point == this->m_path.back().point; }
+    bool         is_closed() const { return this->m_points.front() == this->m_points.back(); }
 
-    bool                                has_arc() const;
+    bool                                has_arc() const { return !m_arcs.empty(); }
     // point count in the path
-    size_t                              size() const { return m_path.size(); }
-    const Geometry::ArcWelder::Path &   get_arc() const { return m_path; }
+    size_t                              size() const { return m_points.size(); }
+    // the path with its arcs, built from the points and the arcs.
+    Geometry::ArcWelder::Path           get_arc() const;
     // get the point at index i in the path (i<size())
-    const Point &                       get_point(size_t i) const { return m_path[i].point; }
-    const Geometry::ArcWelder::Segment &get_arc(size_t i) const { return m_path[i]; }
+    const Point &                       get_point(size_t i) const { return m_points[i]; }
+    Geometry::ArcWelder::Segment        get_arc(size_t i) const;
 
     //works on points only (be careful)
     bool split_at_index(const size_t index, ArcPolyline &p1, ArcPolyline &p2) const;
@@ -354,7 +364,7 @@ public:
 
 
     // Works on points & arc
-    coordf_t              length() const { return Geometry::ArcWelder::path_length<coordf_t>(m_path); }
+    coordf_t              length() const;
     bool                  at_least_length(coordf_t length) const;
     std::pair<int, Point> foot_pt(const Point &pt) const;
     void                  split_at(Point &point, ArcPolyline &p1, ArcPolyline &p2) const;
@@ -786,8 +786,8 @@ std::pair<PrintBase::PrintValidationError, std::string> Print::validate(std::vec
             return { PrintBase::PrintValidationError::pveWrongPosition, 
                 // Test whether the last slicing plane is below or above the print volume.
                 0.5 * (layers[layers.size() - 2] + layers.back()) > this->config().max_print_height + EPSILON ?
-                format(_u8L("The object %1% exceeds the maximum build volume height."), print_object.model_object()->name) :
-                format(_u8L("While the object %1% itself fits the build volume, its last layer exceeds the maximum build volume height."), print_object.model_object()->name) +
+                format(_u8L("The object %1% exceeds the maximum build volume height."), print_object.model_objects_names()) :
+                format(_u8L("While the object %1% itself fits the build volume, its last layer exceeds the maximum build volume height."), print_object.model_objects_names()) +
                 " " + _u8L("You might want to reduce the size of your model or change current print settings and retry.") };
         }
     }
@@ -1218,27 +1218,25 @@ void Print::process()
     name_tbb_thread_pool_threads_set_locale();
     bool something_done = !is_step_done_unguarded(psSkirtBrim);
     BOOST_LOG_TRIVIAL(info) << "Starting the slicing process." << log_memory_info();
+    // The perimeters, infill and ironing steps of a PrintObject only depend on the previous steps of the same PrintObject.
+    // Chain them per object instead of waiting for all the objects to finish a step before starting the next one,
+    // so that the infill of a small object does not wait for the perimeters of a large one.
+    // Each step reports its progress with its own secondary status counter.
+    // The slices may have been compressed by the previous G-code export.
+    for (PrintObject *obj : m_objects)
+        obj->decompress_slices();
+    static_assert(size_t(posCount) <= secondary_status_counters_size, "one secondary status counter per PrintObjectStep");
     secondary_status_counter_reset();
     Slic3r::parallel_for(size_t(0), m_objects.size(),
         [this](const size_t idx) {
             m_objects[idx]->make_perimeters();
-        }
-    );
 #ifdef _DEBUG
-    for (PrintObject* obj : m_objects)
-        for (Layer* lay : obj->layers())
-            for (LayerRegion* lr : lay->regions())
-                lr->perimeters().visit(ptvisitor);
+            PointAssertVisitor object_ptvisitor;
+            for (Layer* lay : m_objects[idx]->layers())
+                for (LayerRegion* lr : lay->regions())
+                    lr->perimeters().visit(object_ptvisitor);
 #endif
-    secondary_status_counter_reset();
-    Slic3r::parallel_for(size_t(0), m_objects.size(),
-        [this](const size_t idx) {
             m_objects[idx]->infill();
-        }
-    );
-    secondary_status_counter_reset();
-    Slic3r::parallel_for(size_t(0), m_objects.size(),
-        [this](const size_t idx) {
             m_objects[idx]->ironing();
         }
     );
@@ -1252,22 +1250,12 @@ void Print::process()
     // this also has to be done sequentially.
     alert_when_supports_needed();
     
+    // Same for the support material and the steps using it, they are chained per object.
     secondary_status_counter_reset();
     Slic3r::parallel_for(size_t(0), m_objects.size(),
         [this](const size_t idx) {
             m_objects[idx]->generate_support_material();
-        }
-    );
-    secondary_status_counter_reset();
-    Slic3r::parallel_for(size_t(0), m_objects.size(),
-        [this](const size_t idx) {
-            PrintObject &obj = *m_objects[idx];
             m_objects[idx]->estimate_curled_extrusions();
-        }
-    );
-    secondary_status_counter_reset();
-    Slic3r::parallel_for(size_t(0), m_objects.size(),
-        [this](const size_t idx) {
             m_objects[idx]->calculate_overhanging_perimeters();
         }
     );
@@ -1405,8 +1393,16 @@ std::string Print::export_gcode(const std::string& path_template, GCodeProcessor
     }
 
     // Create GCode on heap, it has quite a lot of data.
+    for (PrintObject *obj : m_objects)
+        obj->decompress_slices();
     std::unique_ptr<GCodeGenerator> gcode(new GCodeGenerator());
     gcode->do_export(this, path.c_str(), result, thumbnail_cb);
+    if (m_compress_finished_layers) {
+        // The layers are finished, their slices are not read until the next processing or export.
+        gcode.reset();
+        for (PrintObject *obj : m_objects)
+            obj->compress_slices();
+    }
 
     if (m_conflict_result.has_value())
         result->conflict_result = *m_conflict_result;
@@ -1686,8 +1682,12 @@ void Print::_make_skirt(const PrintObjectPtrs &objects, ExtrusionEntityCollectio
         skirt_height_z = std::max(skirt_height_z, object->m_layers[skirt_layers-1]->print_z);
     }
     // Collect points from all layers contained in skirt height.
-    Points points;
-    for (const PrintObject *object : objects) {
+    // Each object is processed in parallel, and only the convex hull of its points is kept,
+    // as it's the only thing the skirt needs: the convex hull of the instances' hulls is the same.
+    std::vector<Points> objects_hull_points(objects.size());
+    Slic3r::parallel_for(size_t(0), objects.size(),
+        [this, &objects, &objects_hull_points, skirt_height_z](const size_t obj_idx) {
+        const PrintObject *object = objects[obj_idx];
         Points object_points;
         // Get object layers up to skirt_height_z.
         for (const Layer *layer : object->m_layers) {
@@ -1735,9 +1735,16 @@ void Print::_make_skirt(const PrintObjectPtrs &objects, ExtrusionEntityCollectio
                 }
             }
         }
+        if (object_points.size() >= 3)
+            objects_hull_points[obj_idx] = std::move(Slic3r::Geometry::convex_hull(object_points).points);
+        else
+            objects_hull_points[obj_idx] = std::move(object_points);
+    });
+    Points points;
+    for (size_t obj_idx = 0; obj_idx < objects.size(); ++obj_idx) {
         // Repeat points for each object copy.
-        for (const PrintInstance &instance : object->instances()) {
-            Points copy_points = object_points;
+        for (const PrintInstance &instance : objects[obj_idx]->instances()) {
+            Points copy_points = objects_hull_points[obj_idx];
             for (Point &pt : copy_points)
                 pt += instance.shift;
             append(points, copy_points);
@@ -2047,13 +2054,13 @@ void Print::alert_when_supports_needed()
                 auto &pair = message_elements.emplace_back(issue_to_alert_message(issue.first.first, issue.first.second),
                                                            std::vector<std::string>{});
                 for (const auto &obj : issue.second) {
-                    pair.second.push_back(obj->m_model_object->name);
+                    pair.second.push_back(obj->model_objects_names());
                 }
             }
         } else {
             // more causes than objects, group by objects
             for (const auto &obj : objects_isssues) {
-                auto &pair = message_elements.emplace_back(obj.first->model_object()->name,  std::vector<std::string>{});
+                auto &pair = message_elements.emplace_back(obj.first->model_objects_names(),  std::vector<std::string>{});
                 for (const auto &issue : obj.second) {
                     pair.second.push_back(issue_to_alert_message(issue.first, issue.second));
                 }
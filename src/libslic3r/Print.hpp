@@ -47,6 +47,7 @@
 #include <functional>
 #include <optional>
 #include <set>
+#include <unordered_map>
 #include <tcbspan/span.hpp>
 
 namespace Slic3r {
@@ -325,6 +326,13 @@ public:
     Transform3d                  trafo_centered() const 
         { Transform3d t = this->trafo(); t.pretranslate(Vec3d(- unscale<double>(m_center_offset.x()), - unscale<double>(m_center_offset.y()), 0)); return t; }
     const PrintInstances&        instances() const      { return m_instances; }
+    // The instances of a ModelObject equal to a preceding one are printed by the preceding one's PrintObject, see Print::apply().
+    bool                         prints_model_object(ObjectID model_object_id) const override {
+        return this->model_object()->id() == model_object_id || std::any_of(m_instances.begin(), m_instances.end(),
+            [model_object_id](const PrintInstance &pi) { return pi.model_instance->get_object()->id() == model_object_id; });
+    }
+    // Names of the ModelObjects printed by this PrintObject, separated by commas, to name it in the warnings.
+    std::string                  model_objects_names() const;
 
     // Whoever will get a non-const pointer to PrintObject will be able to modify its layers.
     LayerPtrs&                   layers()               { return m_layers; }
@@ -451,6 +459,11 @@ private:
     void prepare_infill();
     void clear_fills();
     void infill();
+    // Restore the fill expolygons compressed after a previous ironing.
+    void decompress_fill_expolygons();
+    // Compress the slices of the layers after the G-code export, restore them before the next processing or export.
+    void compress_slices();
+    void decompress_slices();
     void ironing();
     void generate_support_spots();
     void generate_support_material();
@@ -709,6 +722,12 @@ public:
     // Returns true if the last step was finished with success.
     bool                finished() const override { return this->is_step_done(psGCodeExport); }
 
+    // Compress the fill expolygons of the layers once their ironing is generated and the slices of the layers once
+    // the G-code is exported, to lower the memory held by a Print kept alive between slicings.
+    // They are decompressed before being processed or exported again.
+    void                set_compress_finished_layers(bool compress) { m_compress_finished_layers = compress; }
+    bool                compress_finished_layers() const { return m_compress_finished_layers; }
+
     bool                has_infinite_skirt() const;
     bool                has_skirt() const;
     bool                has_brim() const;
@@ -740,7 +759,7 @@ public:
     const PrintObject*          get_object(size_t idx) const { return m_objects[idx]; }
     const PrintObject*          get_print_object_by_model_object_id(ObjectID object_id) const {
         auto it = std::find_if(m_objects.begin(), m_objects.end(),
-                               [object_id](const PrintObject* obj) { return obj->model_object()->id() == object_id; });
+                               [object_id](const PrintObject* obj) { return obj->prints_model_object(object_id); });
         return (it == m_objects.end()) ? nullptr : *it;
     }
     // PrintObject by its ObjectID, to be used to uniquely bind slicing warnings to their source PrintObjects
@@ -863,6 +882,19 @@ private:
     // Cache to store sequential print clearance contours
     Polygons m_sequential_print_clearance_contours;
 
+    // Meshes of the ModelVolumes identified by their content, to find the ModelObjects equal to each other in apply()
+    // without comparing their meshes each time. Meshes with the same content share the same class.
+    struct MeshClass {
+        std::weak_ptr<const TriangleMesh>   mesh;
+        size_t                              hash;
+        size_t                              id;
+    };
+    std::unordered_map<const TriangleMesh*, MeshClass> m_mesh_classes;
+    size_t                                  m_mesh_classes_next_id { 0 };
+    size_t                                  mesh_class(const std::shared_ptr<const TriangleMesh> &mesh);
+
+    bool                                    m_compress_finished_layers { false };
+
     // To allow GCode to set the Print's GCodeExport step status.
     //friend class GCodeGenerator;
     // To allow GCodeProcessor to emit warnings.
@@ -6,6 +6,10 @@
 #include "Print.hpp"
 
 #include <cfloat>
+#include <set>
+#include <unordered_map>
+
+#include <boost/functional/hash.hpp>
 
 namespace Slic3r {
 
@@ -58,8 +62,28 @@ namespace Slic3r {
             delete mv_with_status.first;
 }
 
-static inline void model_volume_list_copy_configs(ModelObject &model_object_dst, const ModelObject &model_object_src, const ModelVolumeType type)
+// Copy the configs of the materials, which changed or were added. Returns the IDs of these materials.
+static inline std::set<t_model_material_id> model_materials_copy_configs(Model &model_dst, const Model &model_src)
+{
+    std::set<t_model_material_id> materials_changed;
+    for (const std::pair<const t_model_material_id, ModelMaterial*> &material_src : model_src.materials) {
+        ModelMaterial *material_dst = model_dst.get_material(material_src.first);
+        if (material_dst == nullptr)
+            model_dst.add_material(material_src.first, *material_src.second);
+        else if (! material_dst->config.timestamp_matches(material_src.second->config))
+            material_dst->config.assign_config(material_src.second->config);
+        else
+            continue;
+        materials_changed.insert(material_src.first);
+    }
+    return materials_changed;
+}
+
+// Returns true if the config of any of the ModelVolumes or of their materials changed.
+static inline bool model_volume_list_copy_configs(ModelObject &model_object_dst, const ModelObject &model_object_src, const ModelVolumeType type,
+    const std::set<t_model_material_id> &materials_changed)
 {
+    bool   config_changed = false;
     size_t i_src, i_dst;
     for (i_src = 0, i_dst = 0; i_src < model_object_src.volumes.size() && i_dst < model_object_dst.volumes.size();) {
         const ModelVolume &mv_src = *model_object_src.volumes[i_src];
@@ -75,7 +99,10 @@ static inline void model_volume_list_copy_configs(ModelObject &model_object_dst,
         assert(mv_src.id() == mv_dst.id());
         // Copy the ModelVolume data.
         mv_dst.name   = mv_src.name;
-		mv_dst.config.assign_config(mv_src.config);
+        if (! mv_dst.config.timestamp_matches(mv_src.config)) {
+            config_changed = true;
+		    mv_dst.config.assign_config(mv_src.config);
+        }
         assert(mv_dst.supported_facets.id() == mv_src.supported_facets.id());
         mv_dst.supported_facets.assign(mv_src.supported_facets);
         assert(mv_dst.seam_facets.id() == mv_src.seam_facets.id());
@@ -84,14 +111,20 @@ static inline void model_volume_list_copy_configs(ModelObject &model_object_dst,
         mv_dst.mm_segmentation_facets.assign(mv_src.mm_segmentation_facets);
         //FIXME what to do with the materials?
         // mv_dst.m_material_id = mv_src.m_material_id;
+        // The material config overrides the volume config in the region config.
+        if (! mv_dst.material_id().empty() && materials_changed.count(mv_dst.material_id()))
+            config_changed = true;
         ++ i_src;
         ++ i_dst;
     }
+    return config_changed;
 }
 
-static inline void layer_height_ranges_copy_configs(t_layer_config_ranges &lr_dst, const t_layer_config_ranges &lr_src)
+// Returns true if the config of any of the layer ranges changed.
+static inline bool layer_height_ranges_copy_configs(t_layer_config_ranges &lr_dst, const t_layer_config_ranges &lr_src)
 {
     assert(lr_dst.size() == lr_src.size());
+    bool config_changed = false;
     auto it_src = lr_src.cbegin();
     for (auto &kvp_dst : lr_dst) {
         const auto &kvp_src = *it_src ++;
@@ -99,8 +132,12 @@ static inline void layer_height_ranges_copy_configs(t_layer_config_ranges &lr_ds
         assert(std::abs(kvp_dst.first.second - kvp_src.first.second) <= EPSILON);
         // Layer heights are allowed do differ in case the layer height table is being overriden by the smooth profile.
         // assert(std::abs(kvp_dst.second.option("layer_height")->get_float() - kvp_src.second.option("layer_height")->get_float()) <= EPSILON);
-        kvp_dst.second = kvp_src.second;
+        if (! kvp_dst.second.timestamp_matches(kvp_src.second)) {
+            config_changed = true;
+            kvp_dst.second = kvp_src.second;
+        }
     }
+    return config_changed;
 }
 
 static inline bool transform3d_lower(const Transform3d &lhs, const Transform3d &rhs) 
@@ -154,6 +191,30 @@ static std::vector<PrintObjectTrafoAndInstances> print_objects_from_model_object
     return std::vector<PrintObjectTrafoAndInstances>(trafos.begin(), trafos.end());
 }
 
+// Will the two ModelObjects produce the same PrintObject if their instances share the same transformation?
+// Only the geometry and the configs are compared, the names and the instances are not. The meshes are compared
+// by their classes, see Print::mesh_class().
+// Objects with variable layer height, layer range modifiers or painted facets are never considered equal.
+// The configs are compared with DynamicConfig::operator==, as ModelConfig::operator== ignores the options defined
+// by only one of the configs: an override present on one object only would be lost by printing it with the other one.
+static bool model_objects_slice_equal(const ModelObject &lhs, const std::vector<size_t> &lhs_mesh_classes, const ModelObject &rhs, const std::vector<size_t> &rhs_mesh_classes)
+{
+    if (lhs_mesh_classes != rhs_mesh_classes || lhs.origin_translation != rhs.origin_translation || lhs.config.get() != rhs.config.get() ||
+        ! lhs.layer_config_ranges.empty() || ! rhs.layer_config_ranges.empty() ||
+        ! lhs.layer_height_profile.empty() || ! rhs.layer_height_profile.empty())
+        return false;
+    assert(lhs.volumes.size() == rhs.volumes.size());
+    for (size_t i = 0; i < lhs.volumes.size(); ++ i) {
+        const ModelVolume &l = *lhs.volumes[i];
+        const ModelVolume &r = *rhs.volumes[i];
+        if (l.type() != r.type() || l.config.get() != r.config.get() || ! transform3d_equal(l.get_matrix(), r.get_matrix()) ||
+            l.is_fdm_support_painted() || l.is_seam_painted() || l.is_mm_painted() ||
+            r.is_fdm_support_painted() || r.is_seam_painted() || r.is_mm_painted())
+            return false;
+    }
+    return true;
+}
+
 // Compare just the layer ranges and their layer heights, not the associated configs.
 // Ignore the layer heights if check_layer_heights is false.
 static bool layer_height_ranges_equal(const t_layer_config_ranges &lr1, const t_layer_config_ranges &lr2, bool check_layer_height)
@@ -352,6 +413,8 @@ struct ModelObjectStatus {
     PrintObjectRegions                         *print_object_regions { nullptr };
     // Status of the above.
     PrintObjectRegionsStatus                    print_object_regions_status { PrintObjectRegionsStatus::Invalid };
+    // Whether the object, volume or layer range configs changed, which may change the PrintRegions.
+    bool                                        configs_changed { true };
 
     // Search by id.
     bool operator<(const ModelObjectStatus &rhs) const { return id < rhs.id; }
@@ -970,6 +1033,32 @@ static PrintObjectRegions* generate_print_object_regions(
     return out.release();
 }
 
+size_t Print::mesh_class(const std::shared_ptr<const TriangleMesh> &mesh)
+{
+    // The meshes of the ModelVolumes are immutable, a living mesh at the same address is the same mesh.
+    if (auto it = m_mesh_classes.find(mesh.get()); it != m_mesh_classes.end() && ! it->second.mesh.expired())
+        return it->second.id;
+    const indexed_triangle_set &its = mesh->its;
+    size_t hash = its.vertices.size();
+    if (! its.vertices.empty())
+        boost::hash_combine(hash, boost::hash_range(its.vertices.front().data(), its.vertices.front().data() + 3 * its.vertices.size()));
+    if (! its.indices.empty())
+        boost::hash_combine(hash, boost::hash_range(its.indices.front().data(), its.indices.front().data() + 3 * its.indices.size()));
+    // A new mesh, compare it with the meshes of the same hash.
+    size_t id = m_mesh_classes_next_id;
+    for (const std::pair<const TriangleMesh* const, MeshClass> &other : m_mesh_classes)
+        if (other.second.hash == hash)
+            if (std::shared_ptr<const TriangleMesh> other_mesh = other.second.mesh.lock();
+                other_mesh && other_mesh->its.vertices == its.vertices && other_mesh->its.indices == its.indices) {
+                id = other.second.id;
+                break;
+            }
+    if (id == m_mesh_classes_next_id)
+        ++ m_mesh_classes_next_id;
+    m_mesh_classes[mesh.get()] = MeshClass{ mesh, hash, id };
+    return id;
+}
+
 Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_config)
 {
 #ifdef _DEBUG
@@ -1053,6 +1142,8 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
 
     // 1) Synchronize model objects.
     bool print_regions_reshuffled = false;
+    // Materials with a new config, their volumes have to be verified against their PrintRegions.
+    std::set<t_model_material_id> materials_changed;
     if (model.id() != m_model.id()) {
         // Kill everything, initialize from scratch.
         // Stop background processing.
@@ -1090,6 +1181,7 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
             	this->invalidate_step(psGCodeExport));
             m_model.custom_gcode_per_print_z = model.custom_gcode_per_print_z;
         }
+        materials_changed = model_materials_copy_configs(m_model, model);
         if (model_object_list_equal(m_model, model)) {
             // The object list did not change.
 			for (const ModelObject *model_object : m_model.objects)
@@ -1264,9 +1356,10 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
             }
             // Synchronize (just copy) the remaining data of ModelVolumes (name, config, custom supports data).
             //FIXME What to do with m_material_id?
-			model_volume_list_copy_configs(model_object /* dst */, model_object_new /* src */, ModelVolumeType::MODEL_PART);
-			model_volume_list_copy_configs(model_object /* dst */, model_object_new /* src */, ModelVolumeType::PARAMETER_MODIFIER);
-            layer_height_ranges_copy_configs(model_object.layer_config_ranges /* dst */, model_object_new.layer_config_ranges /* src */);
+			bool volume_configs_changed = model_volume_list_copy_configs(model_object /* dst */, model_object_new /* src */, ModelVolumeType::MODEL_PART, materials_changed);
+			volume_configs_changed |= model_volume_list_copy_configs(model_object /* dst */, model_object_new /* src */, ModelVolumeType::PARAMETER_MODIFIER, materials_changed);
+            volume_configs_changed |= layer_height_ranges_copy_configs(model_object.layer_config_ranges /* dst */, model_object_new.layer_config_ranges /* src */);
+            model_object_status.configs_changed = object_config_changed || volume_configs_changed;
             // Copy the ModelObject name, input_file and instances. The instances will be compared against PrintObject instances in the next step.
             if (model_object.name != model_object_new.name) {
                 update_apply_status(this->invalidate_step(psGCodeExport));
@@ -1304,13 +1397,52 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
 
     // 4) Generate PrintObjects from ModelObjects and their instances.
     {
+        for (ModelObject *model_object : m_model.objects)
+            const_cast<ModelObjectStatus&>(model_object_status_db.reuse(*model_object)).print_instances = print_objects_from_model_object(*model_object);
+        if (! m_config.complete_objects.value) {
+            // The same part loaded multiple times produces separate ModelObjects. Move instances of a ModelObject equal to some
+            // preceding one to the preceding one's PrintObject with the same transformation, so that such part is sliced just once.
+            // Sequential printing is excluded, as it prints the PrintObjects one after the other in the order of the Plater.
+            // The meshes are hashed only once, when they are seen for the first time.
+            for (auto it = m_mesh_classes.begin(); it != m_mesh_classes.end();)
+                it = it->second.mesh.expired() ? m_mesh_classes.erase(it) : std::next(it);
+            std::unordered_map<const ModelObject*, std::vector<size_t>> mesh_classes;
+            std::unordered_map<size_t, std::vector<ModelObject*>> by_signature;
+            for (ModelObject *model_object : m_model.objects) {
+                auto &print_instances = const_cast<ModelObjectStatus&>(model_object_status_db.reuse(*model_object)).print_instances;
+                if (print_instances.empty())
+                    continue;
+                std::vector<size_t> &object_mesh_classes = mesh_classes[model_object];
+                object_mesh_classes.reserve(model_object->volumes.size());
+                for (const ModelVolume *model_volume : model_object->volumes)
+                    object_mesh_classes.emplace_back(this->mesh_class(model_volume->mesh_ptr()));
+                // Candidates are kept in the order of the ModelObjects, so that the instances are always moved to the first equal
+                // ModelObject, and the order of the PrintObjects follows the order of the ModelObjects.
+                std::vector<ModelObject*> &candidates = by_signature[boost::hash_range(object_mesh_classes.begin(), object_mesh_classes.end())];
+                for (ModelObject *candidate : candidates)
+                    if (model_objects_slice_equal(*candidate, mesh_classes[candidate], *model_object, object_mesh_classes)) {
+                        auto &candidate_instances = const_cast<ModelObjectStatus&>(model_object_status_db.reuse(*candidate)).print_instances;
+                        for (PrintObjectTrafoAndInstances &trafo_and_instances : print_instances)
+                            if (auto it = std::find_if(candidate_instances.begin(), candidate_instances.end(),
+                                    [&trafo_and_instances](const PrintObjectTrafoAndInstances &c) { return transform3d_equal(c.trafo, trafo_and_instances.trafo); });
+                                it != candidate_instances.end()) {
+                                append(it->instances, std::move(trafo_and_instances.instances));
+                                trafo_and_instances.instances.clear();
+                            }
+                        print_instances.erase(std::remove_if(print_instances.begin(), print_instances.end(),
+                            [](const PrintObjectTrafoAndInstances &t) { return t.instances.empty(); }), print_instances.end());
+                        break;
+                    }
+                if (! print_instances.empty())
+                    candidates.emplace_back(model_object);
+            }
+        }
         PrintObjectPtrs print_objects_new;
         print_objects_new.reserve(std::max(m_objects.size(), m_model.objects.size()));
         bool new_objects = false;
         // Walk over all new model objects and check, whether there are matching PrintObjects.
         for (ModelObject *model_object : m_model.objects) {
             ModelObjectStatus &model_object_status = const_cast<ModelObjectStatus&>(model_object_status_db.reuse(*model_object));
-            model_object_status.print_instances    = print_objects_from_model_object(*model_object);
             std::vector<const PrintObjectStatus*> old;
             old.reserve(print_object_status_db.count(*model_object));
             for (const PrintObjectStatus &print_object_status : print_object_status_db.get_range(*model_object))
@@ -1420,6 +1552,10 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
                 print_object_regions->clear();
                 model_object_status.print_object_regions_status = ModelObjectStatus::PrintObjectRegionsStatus::Invalid;
                 print_regions_reshuffled = true;
+            } else if (print_object_regions && region_diff.empty() && ! num_extruders_changed && ! model_object_status.configs_changed) {
+                // Neither the region config defaults nor the configs attached to the ModelObject changed since the regions
+                // were verified by the last apply(), thus they are still valid. This is the common case of tweaking
+                // an option affecting just the G-code export (speeds, cooling), skip walking the volume regions.
             } else if (print_object_regions &&
                 verify_update_print_object_regions(
                     print_object.model_object()->volumes,
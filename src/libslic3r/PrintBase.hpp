@@ -6,6 +6,7 @@
 #define slic3r_PrintBase_hpp_
 
 #include "libslic3r.h"
+#include <array>
 #include <set>
 #include <vector>
 #include <string>
@@ -365,6 +366,8 @@ class PrintObjectBase : public ObjectBase
 public:
     const ModelObject*      model_object() const    { return m_model_object; }
     ModelObject*            model_object()          { return m_model_object; }
+    // Is this PrintObject printing (some of) the instances of the ModelObject with this ID?
+    virtual bool            prints_model_object(ObjectID model_object_id) const { return m_model_object->id() == model_object_id; }
 
 protected:
     PrintObjectBase(ModelObject *model_object) : m_model_object(model_object) {}
@@ -546,13 +549,17 @@ public:
         }
     }
 
+    // The secondary status is counted per step, as the steps of different objects may run at the same time.
+    static constexpr size_t secondary_status_counters_size = 16;
     void secondary_status_counter_reset() {
-        m_secondary_state_counter = 0;
-        m_secondary_state_max = 0;
+        for (size_t step = 0; step < secondary_status_counters_size; ++step) {
+            m_secondary_state_counter[step] = 0;
+            m_secondary_state_max[step] = 0;
+        }
     }
-    void secondary_status_counter_add_max(int32_t max_incr) { m_secondary_state_max += max_incr; }
-    int32_t secondary_status_counter_get_max() { return m_secondary_state_max; }
-    int32_t secondary_status_counter_increment(int32_t incr = 1) { return m_secondary_state_counter.fetch_add(incr); }
+    void secondary_status_counter_add_max(size_t step, int32_t max_incr) { assert(step < secondary_status_counters_size); m_secondary_state_max[step] += max_incr; }
+    int32_t secondary_status_counter_get_max(size_t step) { assert(step < secondary_status_counters_size); return m_secondary_state_max[step]; }
+    int32_t secondary_status_counter_increment(size_t step, int32_t incr = 1) { assert(step < secondary_status_counters_size); return m_secondary_state_counter[step].fetch_add(incr); }
 
 
     typedef std::function<void()>  cancel_callback_type;
@@ -641,8 +648,8 @@ private:
     // The mutex will be used to guard the worker thread against entering a stage
     // while the data influencing the stage is modified.
     mutable std::mutex                      m_state_mutex;
-    std::atomic_int32_t                     m_secondary_state_counter;
-    std::atomic_int32_t                     m_secondary_state_max;
+    std::array<std::atomic_int32_t, secondary_status_counters_size> m_secondary_state_counter {};
+    std::array<std::atomic_int32_t, secondary_status_counters_size> m_secondary_state_max {};
 
     friend PrintTryCancel;
 };
@@ -709,7 +716,7 @@ protected:
             PrintObject *print_object = nullptr;
             size_t       idx_print_object = 0;
             for (; idx_print_object < print_objects.size(); ++ idx_print_object)
-                if (print_objects[idx_print_object]->model_object()->id() == params.single_model_object) {
+                if (print_objects[idx_print_object]->prints_model_object(params.single_model_object)) {
                     print_object = print_objects[idx_print_object];
                     break;
                 }
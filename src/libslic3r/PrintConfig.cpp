@@ -11303,21 +11303,13 @@ std::string validate(const FullPrintConfig& cfg)
 
 // Declare and initialize static caches of StaticPrintConfig derived classes.
 #define PRINT_CONFIG_CACHE_ELEMENT_DEFINITION(r, data, CLASS_NAME) StaticPrintConfig::StaticCache<class Slic3r::CLASS_NAME> BOOST_PP_CAT(CLASS_NAME::s_cache_, CLASS_NAME);
-#define PRINT_CONFIG_CACHE_ELEMENT_INITIALIZATION(r, data, CLASS_NAME) Slic3r::CLASS_NAME::initialize_cache();
+// The caches are initialized on the first use (see STATIC_PRINT_CONFIG_CACHE_BASE), a binary that doesn't use
+// a given StaticPrintConfig doesn't pay for its initialization at startup.
 #define PRINT_CONFIG_CACHE_INITIALIZE(CLASSES_SEQ) \
-    BOOST_PP_SEQ_FOR_EACH(PRINT_CONFIG_CACHE_ELEMENT_DEFINITION, _, BOOST_PP_TUPLE_TO_SEQ(CLASSES_SEQ)) \
-    int print_config_static_initializer() { \
-        /* Putting a trace here to avoid the compiler to optimize out this function. */ \
-        /*BOOST_LOG_TRIVIAL(trace) << "Initializing StaticPrintConfigs";*/ \
-        /* Tamas: alternative solution through a static volatile int. Boost log pollutes stdout and prevents tests from generating clean output */ \
-        static volatile int ret = 1; \
-        BOOST_PP_SEQ_FOR_EACH(PRINT_CONFIG_CACHE_ELEMENT_INITIALIZATION, _, BOOST_PP_TUPLE_TO_SEQ(CLASSES_SEQ)) \
-        return ret; \
-    }
+    BOOST_PP_SEQ_FOR_EACH(PRINT_CONFIG_CACHE_ELEMENT_DEFINITION, _, BOOST_PP_TUPLE_TO_SEQ(CLASSES_SEQ))
 PRINT_CONFIG_CACHE_INITIALIZE((
     PrintObjectConfig, PrintRegionConfig, MachineEnvelopeConfig, GCodeConfig, PrintConfig, FullPrintConfig, 
     SLAMaterialConfig, SLAPrintConfig, SLAPrintObjectConfig, SLAPrinterConfig, SLAFullPrintConfig))
-static int print_config_static_initialized = print_config_static_initializer();
 
 CLIActionsConfigDef::CLIActionsConfigDef()
 {
@@ -11395,6 +11387,15 @@ CLIActionsConfigDef::CLIActionsConfigDef()
     def->cli = "slice|s";
     def->set_default_value(new ConfigOptionBool(false));
 
+    def = this->add("server", coBool);
+    def->label = L("Server mode");
+    def->tooltip = L("Keep running and slice the jobs read from the standard input, one JSON object per line: "
+                     "{\"id\": ..., \"input\": [model files], \"load\": [config files], \"config\": {key: value}, \"output\": file}. "
+                     "A JSON line with the status of each job is written to the standard output. "
+                     "The print and the loaded models are kept between the jobs, to not redo the work that two jobs have in common.");
+    def->cli = "server";
+    def->set_default_value(new ConfigOptionBool(false));
+
     def = this->add("help", coBool);
     def->label = L("Help");
     def->tooltip = L("Show this help.");
@@ -11564,6 +11565,12 @@ CLIMiscConfigDef::CLIMiscConfigDef()
     def->tooltip = L("Sets the maximum number of threads the slicing process will use. If not defined, it will be decided automatically.");
     def->min = 1;
 
+    def = this->add("compress_layers", coBool);
+    def->label = L("Compress finished layers");
+    def->tooltip = L("Compress the infill areas of the layers once their infill and ironing are generated, and their slices "
+                     "once the G-code is exported, to lower the memory used. They are decompressed when they are needed again.");
+    def->set_default_value(new ConfigOptionBool(false));
+
     def = this->add("loglevel", coInt);
     def->label = L("Logging level");
     def->tooltip = L("Sets logging sensitivity. 0:fatal, 1:error, 2:warning, 3:info, 4:debug, 5:trace\n"
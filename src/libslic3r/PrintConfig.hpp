@@ -57,6 +57,8 @@
 #include <boost/preprocessor/tuple/elem.hpp>
 #include <boost/preprocessor/tuple/to_seq.hpp>
 
+#include <mutex>
+
 namespace Slic3r {
 
 enum CompleteObjectSort {
@@ -536,7 +538,7 @@ protected:
         }
 
     protected:
-        std::map<std::string, ptrdiff_t>    m_map_name_to_offset;
+        std::unordered_map<std::string, ptrdiff_t> m_map_name_to_offset;
     };
 
     // Parametrized by the type of the topmost class owning the options.
@@ -549,6 +551,9 @@ protected:
         ~StaticCache() { delete m_defaults; m_defaults = nullptr; }
 
         bool                initialized() const { return ! m_keys.empty(); }
+        // Run the initialization of the cache, once. Thread safe.
+        template<typename Fn>
+        void                initialize_once(Fn &&fn) { std::call_once(m_initialized_flag, std::forward<Fn>(fn)); }
 
         ConfigOption*       optptr(const std::string &name, T *owner) const
         {
@@ -582,16 +587,15 @@ protected:
                     // This option is not defined by the ConfigBase of type T.
                     continue;
                 m_keys.emplace_back(kvp.first);
-                const ConfigOptionDef *def = defs->get(kvp.first);
-                assert(def != nullptr);
-                if (def->default_value)
-                    opt->set(def->default_value.get());
+                if (kvp.second.default_value)
+                    opt->set(kvp.second.default_value.get());
             }
         }
 
     private:
         T                                  *m_defaults;
         std::vector<std::string>            m_keys;
+        std::once_flag                      m_initialized_flag;
     };
 };
 
@@ -611,17 +615,16 @@ public: \
     /* Overrides ConfigBase::keys(). Collect names of all configuration values maintained by this configuration store. */ \
     t_config_option_keys     keys() const override { return s_cache_##CLASS_NAME.keys(); } \
     const t_config_option_keys& keys_ref() const override { return s_cache_##CLASS_NAME.keys(); } \
-    static const CLASS_NAME& defaults() { assert(s_cache_##CLASS_NAME.initialized()); return s_cache_##CLASS_NAME.defaults(); } \
+    static const CLASS_NAME& defaults() { initialize_cache(); return s_cache_##CLASS_NAME.defaults(); } \
 private: \
-    friend int print_config_static_initializer(); \
+    /* The cache is built on the first construction of a CLASS_NAME, not at the start of the application. */ \
     static void initialize_cache() \
     { \
-        assert(! s_cache_##CLASS_NAME.initialized()); \
-        if (! s_cache_##CLASS_NAME.initialized()) { \
+        s_cache_##CLASS_NAME.initialize_once([]() { \
             CLASS_NAME *inst = new CLASS_NAME(1); \
             inst->initialize(s_cache_##CLASS_NAME, (const char*)inst); \
             s_cache_##CLASS_NAME.finalize(inst, inst->def()); \
-        } \
+        }); \
     } \
     /* Cache object holding a key/option map, a list of option keys and a copy of this static config initialized with the defaults. */ \
     static StaticPrintConfig::StaticCache<CLASS_NAME> s_cache_##CLASS_NAME;
@@ -630,7 +633,7 @@ private: \
     STATIC_PRINT_CONFIG_CACHE_BASE(CLASS_NAME) \
 public: \
     /* Public default constructor will initialize the key/option cache and the default object copy if needed. */ \
-    CLASS_NAME() { assert(s_cache_##CLASS_NAME.initialized()); *this = s_cache_##CLASS_NAME.defaults(); } \
+    CLASS_NAME() { initialize_cache(); *this = s_cache_##CLASS_NAME.defaults(); } \
 protected: \
     /* Protected constructor to be called when compounded. */ \
     CLASS_NAME(int) {}
@@ -696,7 +699,7 @@ protected: \
 #define PRINT_CONFIG_CLASS_DERIVED_DEFINE1(CLASS_NAME, CLASSES_PARENTS_TUPLE, PARAMETER_DEFINITION, PARAMETER_REGISTRATION, PARAMETER_HASHES, PARAMETER_EQUALS) \
 class CLASS_NAME : PRINT_CONFIG_CLASS_DERIVED_CLASS_LIST(CLASSES_PARENTS_TUPLE) { \
     STATIC_PRINT_CONFIG_CACHE_DERIVED(CLASS_NAME) \
-    CLASS_NAME() : PRINT_CONFIG_CLASS_DERIVED_INITIALIZER(CLASSES_PARENTS_TUPLE, 0) { assert(s_cache_##CLASS_NAME.initialized()); *this = s_cache_##CLASS_NAME.defaults(); } \
+    CLASS_NAME() : PRINT_CONFIG_CLASS_DERIVED_INITIALIZER(CLASSES_PARENTS_TUPLE, 0) { initialize_cache(); *this = s_cache_##CLASS_NAME.defaults(); } \
 public: \
     PARAMETER_DEFINITION \
     size_t hash() const throw() \
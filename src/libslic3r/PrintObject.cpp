@@ -26,6 +26,7 @@
 #include "I18N.hpp"
 #include "Layer.hpp"
 #include "MutablePolygon.hpp"
+#include "PerimeterGenerator.hpp"
 #include "PrintBase.hpp"
 #include "PrintConfig.hpp"
 #include "Support/SupportMaterial.hpp"
@@ -143,6 +144,19 @@ PrintObject::PrintObject(Print* print, ModelObject* model_object, const Transfor
     m_config.parent = &print->config();
 }
 
+std::string PrintObject::model_objects_names() const
+{
+    std::vector<const ModelObject*> model_objects { this->model_object() };
+    std::string                     names = this->model_object()->name;
+    for (const PrintInstance &instance : m_instances)
+        if (const ModelObject *model_object = instance.model_instance->get_object();
+            std::find(model_objects.begin(), model_objects.end(), model_object) == model_objects.end()) {
+            model_objects.emplace_back(model_object);
+            names += ", " + model_object->name;
+        }
+    return names;
+}
+
 PrintBase::ApplyStatus PrintObject::set_instances(PrintInstances&& instances)
 {
     for (PrintInstance &i : instances) {
@@ -189,8 +203,11 @@ void PrintObject::make_perimeters()
     if (! this->set_started(posPerimeters))
         return;
 
+    // The perimeters regenerate the fill expolygons, they shall not be overwritten by stale compressed ones.
+    this->decompress_fill_expolygons();
+
     m_print->set_status(objectstep_2_percent[PrintObjectStep::posPerimeters], _u8L("Generating perimeters"));
-    m_print->secondary_status_counter_add_max(m_layers.size());
+    m_print->secondary_status_counter_add_max(posPerimeters, m_layers.size());
 
     BOOST_LOG_TRIVIAL(info) << "Generating perimeters..." << log_memory_info();
     
@@ -279,18 +296,20 @@ void PrintObject::make_perimeters()
     }
 
     BOOST_LOG_TRIVIAL(debug) << "Generating perimeters in parallel - start";
+    // Prismatic parts have a lot of layers with the same islands, reuse their perimeters.
+    PerimeterGenerator::Cache perimeter_cache;
     Slic3r::parallel_for(size_t(0), m_layers.size(),
-        [this](const size_t layer_idx) {
+        [this, &perimeter_cache](const size_t layer_idx) {
                 PRINT_OBJECT_TIME_LIMIT_MILLIS(PRINT_OBJECT_TIME_LIMIT_DEFAULT);
                 m_print->throw_if_canceled();
 
                 // updating progress
-                int32_t nb_layers_done = m_print->secondary_status_counter_increment();
-                m_print->set_status( int((nb_layers_done * 100) / m_print->secondary_status_counter_get_max()), L("Generating perimeters: layer %s / %s"), 
-                    { std::to_string(nb_layers_done), std::to_string(m_print->secondary_status_counter_get_max()) }, PrintBase::SlicingStatus::SECONDARY_STATE);
+                int32_t nb_layers_done = m_print->secondary_status_counter_increment(posPerimeters);
+                m_print->set_status( int((nb_layers_done * 100) / m_print->secondary_status_counter_get_max(posPerimeters)), L("Generating perimeters: layer %s / %s"), 
+                    { std::to_string(nb_layers_done), std::to_string(m_print->secondary_status_counter_get_max(posPerimeters)) }, PrintBase::SlicingStatus::SECONDARY_STATE);
 
                 // make perimeters
-                m_layers[layer_idx]->make_perimeters();
+                m_layers[layer_idx]->make_perimeters(&perimeter_cache);
         }
     );
     m_print->throw_if_canceled();
@@ -316,6 +335,8 @@ void PrintObject::prepare_infill()
     if (!this->set_started(posPrepareInfill))
         return;
 
+    this->decompress_fill_expolygons();
+
     m_print->set_status(objectstep_2_percent[PrintObjectStep::posPrepareInfill], L("Preparing infill"));
     if (m_print->objects().size() == 1) {
         m_print->set_status(0, "", PrintBase::SlicingStatus::DEFAULT | PrintBase::SlicingStatus::SECONDARY_STATE);
@@ -327,7 +348,7 @@ void PrintObject::prepare_infill()
         // Clean surfaces (1%)  -> 5    80
         // Put bridges over sparse infill (12%) -> 15 95
         // Combine infill (1%) -> 5     100
-        m_print->secondary_status_counter_add_max(100);
+        m_print->secondary_status_counter_add_max(posPrepareInfill, 100);
     }
 
     if (m_typed_slices) {
@@ -365,10 +386,10 @@ void PrintObject::prepare_infill()
     if (m_print->objects().size() == 1) {
         m_print->set_status(0, L("Detect surfaces types"), {}, PrintBase::SlicingStatus::SECONDARY_STATE);
     } else {
-        int32_t advancement_count = m_print->secondary_status_counter_increment(25);
-        m_print->set_status(advancement_count * 100 / m_print->secondary_status_counter_get_max(), L("Process objects: %s / %s"),
+        int32_t advancement_count = m_print->secondary_status_counter_increment(posPrepareInfill, 25);
+        m_print->set_status(advancement_count * 100 / m_print->secondary_status_counter_get_max(posPrepareInfill), L("Process objects: %s / %s"),
                             {std::to_string(advancement_count),
-                             std::to_string(m_print->secondary_status_counter_get_max())},
+                             std::to_string(m_print->secondary_status_counter_get_max(posPrepareInfill))},
                             PrintBase::SlicingStatus::SECONDARY_STATE);
     }
     this->detect_surfaces_type();
@@ -396,10 +417,10 @@ void PrintObject::prepare_infill()
     // Also tiny stInternal surfaces are turned to stInternalSolid.
     BOOST_LOG_TRIVIAL(info) << "Preparing fill surfaces..." << log_memory_info();
     if (m_print->objects().size() > 1) {
-        int32_t advancement_count = m_print->secondary_status_counter_increment(5);
-        m_print->set_status(advancement_count * 100 / m_print->secondary_status_counter_get_max(), L("Process objects: %s / %s"),
+        int32_t advancement_count = m_print->secondary_status_counter_increment(posPrepareInfill, 5);
+        m_print->set_status(advancement_count * 100 / m_print->secondary_status_counter_get_max(posPrepareInfill), L("Process objects: %s / %s"),
                             {std::to_string(advancement_count),
-                             std::to_string(m_print->secondary_status_counter_get_max())},
+                             std::to_string(m_print->secondary_status_counter_get_max(posPrepareInfill))},
                             PrintBase::SlicingStatus::SECONDARY_STATE);
     }
     for (size_t layer_idx = 0; layer_idx < m_layers.size(); ++layer_idx) {
@@ -453,11 +474,11 @@ void PrintObject::prepare_infill()
         if (m_print->objects().size() == 1) {
             m_print->set_status(30, L("Process external surfaces"), {}, PrintBase::SlicingStatus::SECONDARY_STATE);
         } else {
-            int32_t advancement_count = m_print->secondary_status_counter_increment(15);
-            m_print->set_status(advancement_count * 100 / m_print->secondary_status_counter_get_max(),
+            int32_t advancement_count = m_print->secondary_status_counter_increment(posPrepareInfill, 15);
+            m_print->set_status(advancement_count * 100 / m_print->secondary_status_counter_get_max(posPrepareInfill),
                                 L("Process objects: %s / %s"),
                                 {std::to_string(advancement_count),
-                                 std::to_string(m_print->secondary_status_counter_get_max())},
+                                 std::to_string(m_print->secondary_status_counter_get_max(posPrepareInfill))},
                                 PrintBase::SlicingStatus::SECONDARY_STATE);
         }
         this->process_external_surfaces(true /* old*/);
@@ -484,10 +505,10 @@ void PrintObject::prepare_infill()
     if (m_print->objects().size() == 1) {
         m_print->set_status(45, L("Discover shells"), {}, PrintBase::SlicingStatus::SECONDARY_STATE);
     } else {
-        int32_t advancement_count = m_print->secondary_status_counter_increment(30);
-        m_print->set_status(advancement_count * 100 / m_print->secondary_status_counter_get_max(), L("Process objects: %s / %s"),
+        int32_t advancement_count = m_print->secondary_status_counter_increment(posPrepareInfill, 30);
+        m_print->set_status(advancement_count * 100 / m_print->secondary_status_counter_get_max(posPrepareInfill), L("Process objects: %s / %s"),
                             {std::to_string(advancement_count),
-                             std::to_string(m_print->secondary_status_counter_get_max())},
+                             std::to_string(m_print->secondary_status_counter_get_max(posPrepareInfill))},
                             PrintBase::SlicingStatus::SECONDARY_STATE);
     }
     this->discover_vertical_shells();
@@ -530,11 +551,11 @@ void PrintObject::prepare_infill()
         if (m_print->objects().size() == 1) {
             m_print->set_status(60, L("Process external surfaces"), {}, PrintBase::SlicingStatus::SECONDARY_STATE);
         } else {
-            int32_t advancement_count = m_print->secondary_status_counter_increment(15);
-            m_print->set_status(advancement_count * 100 / m_print->secondary_status_counter_get_max(),
+            int32_t advancement_count = m_print->secondary_status_counter_increment(posPrepareInfill, 15);
+            m_print->set_status(advancement_count * 100 / m_print->secondary_status_counter_get_max(posPrepareInfill),
                                 L("Process objects: %s / %s"),
                                 {std::to_string(advancement_count),
-                                 std::to_string(m_print->secondary_status_counter_get_max())},
+                                 std::to_string(m_print->secondary_status_counter_get_max(posPrepareInfill))},
                                 PrintBase::SlicingStatus::SECONDARY_STATE);
         }
         this->process_external_surfaces(false /*!old =  new*/);
@@ -610,10 +631,10 @@ void PrintObject::prepare_infill()
     if (m_print->objects().size() == 1) {
         m_print->set_status( 75, L("Clean surfaces"), {}, PrintBase::SlicingStatus::SECONDARY_STATE);
     } else {
-        int32_t advancement_count = m_print->secondary_status_counter_increment(5);
-        m_print->set_status(advancement_count * 100 / m_print->secondary_status_counter_get_max(), L("Process objects: %s / %s"),
+        int32_t advancement_count = m_print->secondary_status_counter_increment(posPrepareInfill, 5);
+        m_print->set_status(advancement_count * 100 / m_print->secondary_status_counter_get_max(posPrepareInfill), L("Process objects: %s / %s"),
                             {std::to_string(advancement_count),
-                             std::to_string(m_print->secondary_status_counter_get_max())},
+                             std::to_string(m_print->secondary_status_counter_get_max(posPrepareInfill))},
                             PrintBase::SlicingStatus::SECONDARY_STATE);
     }
     this->clean_surfaces();
@@ -675,10 +696,10 @@ void PrintObject::prepare_infill()
     if (m_print->objects().size() == 1) {
         m_print->set_status( 80, L("Put bridges over sparse infill"), {}, PrintBase::SlicingStatus::SECONDARY_STATE);
     } else {
-        int32_t advancement_count = m_print->secondary_status_counter_increment(15);
-        m_print->set_status(advancement_count * 100 / m_print->secondary_status_counter_get_max(), L("Process objects: %s / %s"),
+        int32_t advancement_count = m_print->secondary_status_counter_increment(posPrepareInfill, 15);
+        m_print->set_status(advancement_count * 100 / m_print->secondary_status_counter_get_max(posPrepareInfill), L("Process objects: %s / %s"),
                             {std::to_string(advancement_count),
-                             std::to_string(m_print->secondary_status_counter_get_max())},
+                             std::to_string(m_print->secondary_status_counter_get_max(posPrepareInfill))},
                             PrintBase::SlicingStatus::SECONDARY_STATE);
     }
 
@@ -759,10 +780,10 @@ void PrintObject::prepare_infill()
     if (m_print->objects().size() == 1) {
         m_print->set_status( 95, L("Combine infill"), {}, PrintBase::SlicingStatus::SECONDARY_STATE);
     } else {
-        int32_t advancement_count = m_print->secondary_status_counter_increment(5);
-        m_print->set_status(advancement_count * 100 / m_print->secondary_status_counter_get_max(), L("Process objects: %s / %s"),
+        int32_t advancement_count = m_print->secondary_status_counter_increment(posPrepareInfill, 5);
+        m_print->set_status(advancement_count * 100 / m_print->secondary_status_counter_get_max(posPrepareInfill), L("Process objects: %s / %s"),
                             {std::to_string(advancement_count),
-                             std::to_string(m_print->secondary_status_counter_get_max())},
+                             std::to_string(m_print->secondary_status_counter_get_max(posPrepareInfill))},
                             PrintBase::SlicingStatus::SECONDARY_STATE);
     }
     this->combine_infill();
@@ -788,10 +809,10 @@ void PrintObject::prepare_infill()
     _compute_max_sparse_spacing();
     
     if (m_print->objects().size() > 1) {
-        int32_t advancement_count = m_print->secondary_status_counter_increment(0);
-        m_print->set_status(advancement_count * 100 / m_print->secondary_status_counter_get_max(), L("Process objects: %s / %s"),
+        int32_t advancement_count = m_print->secondary_status_counter_increment(posPrepareInfill, 0);
+        m_print->set_status(advancement_count * 100 / m_print->secondary_status_counter_get_max(posPrepareInfill), L("Process objects: %s / %s"),
                             {std::to_string(advancement_count),
-                             std::to_string(m_print->secondary_status_counter_get_max())},
+                             std::to_string(m_print->secondary_status_counter_get_max(posPrepareInfill))},
                             PrintBase::SlicingStatus::SECONDARY_STATE);
     }
     this->set_done(posPrepareInfill);
@@ -836,7 +857,7 @@ void PrintObject::infill()
     if (this->set_started(posInfill)) {
         // TRN Status for the Print calculation 
         m_print->set_status(objectstep_2_percent[PrintObjectStep::posInfill], L("Infilling layers"));
-        m_print->secondary_status_counter_add_max(m_layers.size());
+        m_print->secondary_status_counter_add_max(posInfill, m_layers.size());
         const auto& adaptive_fill_octree = this->m_adaptive_fill_octrees.first;
         const auto& support_fill_octree = this->m_adaptive_fill_octrees.second;
 
@@ -846,13 +867,15 @@ void PrintObject::infill()
             (const size_t layer_idx) {
                 PRINT_OBJECT_TIME_LIMIT_MILLIS(PRINT_OBJECT_TIME_LIMIT_DEFAULT);
                     // updating progress
-                    int32_t nb_layers_done = m_print->secondary_status_counter_increment();
-                    m_print->set_status(100 * nb_layers_done / m_print->secondary_status_counter_get_max(), L("Infilling layer %s / %s"),
-                                    {std::to_string(nb_layers_done), std::to_string(m_print->secondary_status_counter_get_max())},
+                    int32_t nb_layers_done = m_print->secondary_status_counter_increment(posInfill);
+                    m_print->set_status(100 * nb_layers_done / m_print->secondary_status_counter_get_max(posInfill), L("Infilling layer %s / %s"),
+                                    {std::to_string(nb_layers_done), std::to_string(m_print->secondary_status_counter_get_max(posInfill))},
                         PrintBase::SlicingStatus::SECONDARY_STATE);
 
                     std::chrono::time_point<std::chrono::system_clock> start_make_fill = std::chrono::system_clock::now();
                     m_print->throw_if_canceled();
+                    for (LayerRegion *layerm : m_layers[layer_idx]->regions())
+                        layerm->decompress_fill_expolygons();
                     m_layers[layer_idx]->make_fills(adaptive_fill_octree.get(), support_fill_octree.get(), this->m_lightning_generator.get());
             }
         );
@@ -866,24 +889,59 @@ void PrintObject::infill()
     }
 }
 
+void PrintObject::decompress_fill_expolygons()
+{
+    Slic3r::parallel_for(size_t(0), m_layers.size(),
+        [this](const size_t layer_idx) {
+            for (LayerRegion *layerm : m_layers[layer_idx]->regions())
+                layerm->decompress_fill_expolygons();
+        }
+    );
+}
+
+void PrintObject::compress_slices()
+{
+    Slic3r::parallel_for(size_t(0), m_layers.size(),
+        [this](const size_t layer_idx) {
+            m_layers[layer_idx]->compress_slices();
+        }
+    );
+}
+
+void PrintObject::decompress_slices()
+{
+    Slic3r::parallel_for(size_t(0), m_layers.size(),
+        [this](const size_t layer_idx) {
+            m_layers[layer_idx]->decompress_slices();
+        }
+    );
+}
+
 void PrintObject::ironing()
 {
     if (this->set_started(posIroning)) {
         m_print->set_status(objectstep_2_percent[PrintObjectStep::posIroning], L("Ironing"));
-        m_print->secondary_status_counter_add_max(m_layers.size());
+        m_print->secondary_status_counter_add_max(posIroning, m_layers.size());
         BOOST_LOG_TRIVIAL(debug) << "Ironing in parallel - start";
             // Ironing starting with layer 0 to support ironing all surfaces.
         Slic3r::parallel_for(size_t(0), m_layers.size(),
             [this](const size_t layer_idx) {
                 PRINT_OBJECT_TIME_LIMIT_MILLIS(PRINT_OBJECT_TIME_LIMIT_DEFAULT);
                 // updating progress
-                int32_t nb_layers_done = m_print->secondary_status_counter_increment();
-                m_print->set_status(100 * nb_layers_done / m_print->secondary_status_counter_get_max(), L("Ironing layer %s / %s"),
-                                {std::to_string(nb_layers_done), std::to_string(m_print->secondary_status_counter_get_max())},
+                int32_t nb_layers_done = m_print->secondary_status_counter_increment(posIroning);
+                m_print->set_status(100 * nb_layers_done / m_print->secondary_status_counter_get_max(posIroning), L("Ironing layer %s / %s"),
+                                {std::to_string(nb_layers_done), std::to_string(m_print->secondary_status_counter_get_max(posIroning))},
                     PrintBase::SlicingStatus::SECONDARY_STATE);
 
                 m_print->throw_if_canceled();
+                for (LayerRegion *layerm : m_layers[layer_idx]->regions())
+                    layerm->decompress_fill_expolygons();
                 m_layers[layer_idx]->make_ironing();
+                // The ironing is the last reader of the fill expolygons, they are not read anymore unless the infill
+                // or the ironing is regenerated.
+                if (m_print->compress_finished_layers())
+                    for (LayerRegion *layerm : m_layers[layer_idx]->regions())
+                        layerm->compress_fill_expolygons();
             }
         );
         m_print->throw_if_canceled();
@@ -899,7 +957,7 @@ void PrintObject::generate_support_spots()
         BOOST_LOG_TRIVIAL(debug) << "Searching support spots - start";
         m_print->set_status(objectstep_2_percent[PrintObjectStep::posSupportSpotsSearch], L("Searching support spots"));
         if (m_print->objects().size() > 1) {
-            m_print->secondary_status_counter_add_max(1);
+            m_print->secondary_status_counter_add_max(posSupportSpotsSearch, 1);
             m_print->set_status(0. / m_print->objects().size(), L("Object %s / %s"),
                             {std::to_string(0), std::to_string(m_print->objects().size())},
                 PrintBase::SlicingStatus::SECONDARY_STATE);
@@ -925,10 +983,10 @@ void PrintObject::generate_support_spots()
 
         // updating progress
         if (m_print->objects().size() > 1) {
-            int32_t nb_objects_done = m_print->secondary_status_counter_increment();
-            m_print->set_status(100 * (nb_objects_done + 1) / m_print->secondary_status_counter_get_max(),
+            int32_t nb_objects_done = m_print->secondary_status_counter_increment(posSupportSpotsSearch);
+            m_print->set_status(100 * (nb_objects_done + 1) / m_print->secondary_status_counter_get_max(posSupportSpotsSearch),
                                 L("Object %s / %s"),
-                                {std::to_string(nb_objects_done + 1), std::to_string(m_print->secondary_status_counter_get_max())},
+                                {std::to_string(nb_objects_done + 1), std::to_string(m_print->secondary_status_counter_get_max(posSupportSpotsSearch))},
                                 PrintBase::SlicingStatus::SECONDARY_STATE);
         }
 
@@ -942,7 +1000,7 @@ void PrintObject::generate_support_material()
     if (this->set_started(posSupportMaterial)) {
         m_print->set_status(objectstep_2_percent[PrintObjectStep::posSupportMaterial], L("Generating support material"));
         if (m_print->objects().size() > 1) {
-            m_print->secondary_status_counter_add_max(1);
+            m_print->secondary_status_counter_add_max(posSupportMaterial, 1);
             m_print->set_status(0. / m_print->objects().size(), L("Object %s / %s"),
                             {std::to_string(0), std::to_string(m_print->objects().size())},
                 PrintBase::SlicingStatus::SECONDARY_STATE);
@@ -966,10 +1024,10 @@ void PrintObject::generate_support_material()
         
         // updating progress
         if (m_print->objects().size() > 1) {
-            int32_t nb_objects_done = m_print->secondary_status_counter_increment();
-            m_print->set_status(100 * (nb_objects_done + 1) / m_print->secondary_status_counter_get_max(),
+            int32_t nb_objects_done = m_print->secondary_status_counter_increment(posSupportMaterial);
+            m_print->set_status(100 * (nb_objects_done + 1) / m_print->secondary_status_counter_get_max(posSupportMaterial),
                                 L("Object %s / %s"),
-                                {std::to_string(nb_objects_done + 1), std::to_string(m_print->secondary_status_counter_get_max())},
+                                {std::to_string(nb_objects_done + 1), std::to_string(m_print->secondary_status_counter_get_max(posSupportMaterial))},
                                 PrintBase::SlicingStatus::SECONDARY_STATE);
         }
     }
@@ -981,7 +1039,7 @@ void PrintObject::simplify_extrusion_path()
         const PrintConfig& print_config = this->print()->config();
         const bool spiral_mode = print_config.spiral_vase;
         const bool enable_arc_fitting = print_config.arc_fitting != ArcFittingType::Disabled && !spiral_mode;
-        m_print->secondary_status_counter_add_max(m_layers.size() + m_support_layers.size());
+        m_print->secondary_status_counter_add_max(posSimplifyPath, m_layers.size() + m_support_layers.size());
         BOOST_LOG_TRIVIAL(debug) << "Simplify extrusion path of object in parallel - start";
         //BBS: infill and walls
         Slic3r::parallel_for(size_t(0), m_layers.size(),
@@ -990,10 +1048,10 @@ void PrintObject::simplify_extrusion_path()
                 m_layers[layer_idx]->simplify_extrusion_path();
                 
                 // updating progress
-                int32_t nb_layers_done = m_print->secondary_status_counter_increment() + 1;
-                m_print->set_status(int((nb_layers_done * 100) / m_print->secondary_status_counter_get_max()),
+                int32_t nb_layers_done = m_print->secondary_status_counter_increment(posSimplifyPath) + 1;
+                m_print->set_status(int((nb_layers_done * 100) / m_print->secondary_status_counter_get_max(posSimplifyPath)),
                                 L("Optimizing layer %s / %s"),
-                                {std::to_string(nb_layers_done), std::to_string(m_print->secondary_status_counter_get_max())},
+                                {std::to_string(nb_layers_done), std::to_string(m_print->secondary_status_counter_get_max(posSimplifyPath))},
                                 PrintBase::SlicingStatus::SECONDARY_STATE);
             }
         );
@@ -1031,10 +1089,10 @@ void PrintObject::simplify_extrusion_path()
                 m_support_layers[layer_idx]->simplify_support_extrusion_path();
 
                 // updating progress
-                int32_t nb_layers_done = m_print->secondary_status_counter_increment() + 1;
-                m_print->set_status(int((nb_layers_done * 100) / m_print->secondary_status_counter_get_max()),
+                int32_t nb_layers_done = m_print->secondary_status_counter_increment(posSimplifyPath) + 1;
+                m_print->set_status(int((nb_layers_done * 100) / m_print->secondary_status_counter_get_max(posSimplifyPath)),
                                 L("Optimizing layer %s / %s"),
-                                {std::to_string(nb_layers_done), std::to_string(m_print->secondary_status_counter_get_max())},
+                                {std::to_string(nb_layers_done), std::to_string(m_print->secondary_status_counter_get_max(posSimplifyPath))},
                                 PrintBase::SlicingStatus::SECONDARY_STATE);
             }
         );
@@ -1049,7 +1107,7 @@ void PrintObject::estimate_curled_extrusions()
     if (this->set_started(posEstimateCurledExtrusions)) {
         m_print->set_status(objectstep_2_percent[PrintObjectStep::posEstimateCurledExtrusions], L("Estimate curled extrusions"));
         if (m_print->objects().size() > 1) {
-            m_print->secondary_status_counter_add_max(1);
+            m_print->secondary_status_counter_add_max(posEstimateCurledExtrusions, 1);
             m_print->set_status(0. / m_print->objects().size(), L("Object %s / %s"),
                             {std::to_string(0), std::to_string(m_print->objects().size())},
                 PrintBase::SlicingStatus::SECONDARY_STATE);
@@ -1078,10 +1136,10 @@ void PrintObject::estimate_curled_extrusions()
         
         // updating progress
         if (m_print->objects().size() > 1) {
-            int32_t nb_objects_done = m_print->secondary_status_counter_increment();
-            m_print->set_status(100 * (nb_objects_done + 1) / m_print->secondary_status_counter_get_max(),
+            int32_t nb_objects_done = m_print->secondary_status_counter_increment(posEstimateCurledExtrusions);
+            m_print->set_status(100 * (nb_objects_done + 1) / m_print->secondary_status_counter_get_max(posEstimateCurledExtrusions),
                             L("Object %s / %s"),
-                            {std::to_string(nb_objects_done + 1), std::to_string(m_print->secondary_status_counter_get_max())},
+                            {std::to_string(nb_objects_done + 1), std::to_string(m_print->secondary_status_counter_get_max(posEstimateCurledExtrusions))},
                             PrintBase::SlicingStatus::SECONDARY_STATE);
         }
     }
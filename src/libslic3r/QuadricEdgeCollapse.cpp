@@ -5,6 +5,8 @@
 #include "QuadricEdgeCollapse.hpp"
 #include <tuple>
 #include <optional>
+#include <numeric>
+#include <mutex>
 #include "MutablePriorityQueue.hpp"
 #include <tbb/parallel_for.h>
 
@@ -59,6 +61,8 @@ namespace QuadricEdgeCollapse {
     using Indices = std::vector<stl_triangle_vertex_indices>;
     using ThrowOnCancel = std::function<void(void)>;
     using StatusFn = std::function<void(int)>;
+    // Vertices which must keep their index and position, empty for none.
+    using LockedVertices = std::vector<bool>;
     // smallest error caused by edges, identify smallest edge in triangle
     struct Error
     {
@@ -120,7 +124,7 @@ namespace QuadricEdgeCollapse {
     double vertex_error(const SymMat &q, const Vec3d &vertex);
     SymMat create_quadric(const Triangle &t, const Vec3d& n, const Vertices &vertices);
     std::tuple<TriangleInfos, VertexInfos, EdgeInfos, Errors> 
-    init(const indexed_triangle_set &its, ThrowOnCancel& throw_on_cancel, StatusFn& status_fn);
+    init(const indexed_triangle_set &its, const LockedVertices &locked, ThrowOnCancel& throw_on_cancel, StatusFn& status_fn);
     std::optional<uint32_t> find_triangle_index1(uint32_t vi, const VertexInfo& v_info,
         uint32_t ti, const EdgeInfos& e_infos, const Indices& indices);
     void reorder_edges(EdgeInfos &e_infos, const VertexInfo &v_info, uint32_t ti0, uint32_t ti1);
@@ -131,13 +135,22 @@ namespace QuadricEdgeCollapse {
     bool create_no_volume(uint32_t vi0, uint32_t vi1, uint32_t ti0, uint32_t ti1,
         const VertexInfo &v_info0, const VertexInfo &v_info1, const EdgeInfos &e_infos, const Indices &indices);
     // find edge with smallest error in triangle
-    Vec3d calculate_3errors(const Triangle &t, const Vertices &vertices, const VertexInfos &v_infos);
-    Error calculate_error(uint32_t ti, const Triangle& t,const Vertices &vertices, const VertexInfos& v_infos, unsigned char& min_index);
+    Vec3d calculate_3errors(const Triangle &t, const Vertices &vertices, const VertexInfos &v_infos, const LockedVertices &locked);
+    Error calculate_error(uint32_t ti, const Triangle& t,const Vertices &vertices, const VertexInfos& v_infos, const LockedVertices &locked, unsigned char& min_index);
     void remove_triangle(EdgeInfos &e_infos, VertexInfo &v_info, uint32_t ti);
     void change_neighbors(EdgeInfos &e_infos, VertexInfos &v_infos, uint32_t ti0, uint32_t ti1,
                           uint32_t vi0, uint32_t vi1, uint32_t vi_top0,
                           const Triangle &t1, CopyEdgeInfos& infos, EdgeInfos &e_infos1);
-    void compact(const VertexInfos &v_infos, const TriangleInfos &t_infos, const EdgeInfos &e_infos, indexed_triangle_set &its);
+    // new_vertex_indices: optional output, new index of each vertex or max uint32_t for removed vertices
+    void compact(const VertexInfos &v_infos, const TriangleInfos &t_infos, const EdgeInfos &e_infos, indexed_triangle_set &its,
+                 std::vector<uint32_t> *new_vertex_indices = nullptr);
+    // Simplification of a single mesh or of a single partition of a mesh, see its_quadric_edge_collapse()
+    // The edges touching a locked vertex are never collapsed.
+    void collapse(indexed_triangle_set &its, uint32_t triangle_count, float *max_error,
+                  ThrowOnCancel throw_on_cancel, StatusFn status_fn,
+                  const LockedVertices &locked = {}, std::vector<uint32_t> *new_vertex_indices = nullptr);
+    // Split triangles of the mesh into spatial partitions of at most max_partition_size triangles.
+    std::vector<std::vector<uint32_t>> create_partitions(const indexed_triangle_set &its, uint32_t max_partition_size);
 
 #ifdef EXPENSIVE_DEBUG_CHECKS
     void store_surround(const char *obj_filename, size_t triangle_index, int depth, const indexed_triangle_set &its,
@@ -157,6 +170,10 @@ namespace QuadricEdgeCollapse {
     const int status_set_offsets = 10;
     const int status_calc_errors = 30;
     const int status_create_refs = 10;
+    // meshes are split into partitions of this size for the parallel simplification
+    const uint32_t partition_size = 250000;
+    // share of the status for the simplification of partitions, the rest is for the final pass over the seams
+    const int status_partitions_size = 80; // in percents
     } // namespace QuadricEdgeCollapse
 
 using namespace QuadricEdgeCollapse;
@@ -167,6 +184,198 @@ void Slic3r::its_quadric_edge_collapse(
     float *                   max_error,
     std::function<void(void)> throw_on_cancel,
     std::function<void(int)>  status_fn)
+{
+    if (its.indices.size() >= 2 * size_t(partition_size))
+        its_quadric_edge_collapse_partitioned(its, triangle_count, max_error, throw_on_cancel, status_fn);
+    else
+        collapse(its, triangle_count, max_error, throw_on_cancel, status_fn);
+}
+
+void Slic3r::its_quadric_edge_collapse_partitioned(
+    indexed_triangle_set &    its,
+    uint32_t                  triangle_count,
+    float *                   max_error,
+    std::function<void(void)> throw_on_cancel,
+    std::function<void(int)>  status_fn,
+    uint32_t                  max_partition_size)
+{
+    if (triangle_count >= its.indices.size()) return;
+    if (max_error != nullptr && *max_error <= 0.f) return;
+    if (throw_on_cancel == nullptr) throw_on_cancel = []() {};
+    if (status_fn == nullptr) status_fn = [](int) {};
+    if (max_partition_size == 0) max_partition_size = partition_size;
+
+    std::vector<std::vector<uint32_t>> partitions = create_partitions(its, max_partition_size);
+    if (partitions.size() < 2) {
+        collapse(its, triangle_count, max_error, throw_on_cancel, status_fn);
+        return;
+    }
+
+    // Vertices shared by more partitions are locked, so that the partitions fit together after the simplification.
+    constexpr int shared = -2;
+    std::vector<int> vertex_partition(its.vertices.size(), -1);
+    for (size_t pi = 0; pi < partitions.size(); ++pi)
+        for (uint32_t ti : partitions[pi])
+            for (int vi : its.indices[ti]) {
+                int &vp = vertex_partition[vi];
+                if (vp == -1)
+                    vp = int(pi);
+                else if (vp != int(pi))
+                    vp = shared;
+            }
+
+    struct Part
+    {
+        indexed_triangle_set its;
+        // index of the vertex in the simplified part -> index in the input mesh, for the locked vertices only
+        std::vector<uint32_t> global_vertex;
+        float                 last_error = 0.f;
+    };
+    std::vector<Part> parts(partitions.size());
+    std::mutex status_mutex;
+    size_t     finished_parts = 0;
+    throw_on_cancel();
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, partitions.size(), 1), [&](const tbb::blocked_range<size_t> &range) {
+        for (size_t pi = range.begin(); pi < range.end(); ++pi) {
+            const std::vector<uint32_t> &triangles = partitions[pi];
+            Part                        &part      = parts[pi];
+            // vertices of the part sorted by index in the input mesh
+            std::vector<uint32_t> vertices;
+            vertices.reserve(triangles.size() * 3);
+            for (uint32_t ti : triangles)
+                for (int vi : its.indices[ti])
+                    vertices.emplace_back(uint32_t(vi));
+            std::sort(vertices.begin(), vertices.end());
+            vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+
+            part.its.vertices.reserve(vertices.size());
+            LockedVertices locked(vertices.size(), false);
+            for (size_t i = 0; i < vertices.size(); ++i) {
+                part.its.vertices.emplace_back(its.vertices[vertices[i]]);
+                locked[i] = vertex_partition[vertices[i]] == shared;
+            }
+            part.its.indices.reserve(triangles.size());
+            for (uint32_t ti : triangles) {
+                Triangle t = its.indices[ti];
+                for (int &vi : t)
+                    vi = int(std::lower_bound(vertices.begin(), vertices.end(), uint32_t(vi)) - vertices.begin());
+                part.its.indices.emplace_back(t);
+            }
+
+            // each part is reduced in proportion to its size
+            uint32_t part_triangle_count = uint32_t(uint64_t(triangle_count) * triangles.size() / its.indices.size());
+            part.last_error = (max_error == nullptr) ? std::numeric_limits<float>::max() : *max_error;
+            std::vector<uint32_t> new_vertex_indices;
+            collapse(part.its, part_triangle_count, &part.last_error, throw_on_cancel, nullptr, locked, &new_vertex_indices);
+            if (new_vertex_indices.empty()) {
+                // nothing to reduce, vertices are kept as they are
+                new_vertex_indices.resize(vertices.size());
+                std::iota(new_vertex_indices.begin(), new_vertex_indices.end(), 0);
+                part.last_error = 0.f;
+            }
+
+            part.global_vertex.assign(part.its.vertices.size(), std::numeric_limits<uint32_t>::max());
+            for (size_t i = 0; i < vertices.size(); ++i)
+                if (locked[i] && new_vertex_indices[i] != std::numeric_limits<uint32_t>::max())
+                    part.global_vertex[new_vertex_indices[i]] = vertices[i];
+
+            std::lock_guard<std::mutex> lk(status_mutex);
+            status_fn(int(++finished_parts * status_partitions_size / partitions.size()));
+        }
+    });
+
+    // Stitch the parts together, in the order of the parts to stay deterministic.
+    float partitions_error = 0.f;
+    indexed_triangle_set merged;
+    std::vector<uint32_t> global_to_merged(its.vertices.size(), std::numeric_limits<uint32_t>::max());
+    for (Part &part : parts) {
+        partitions_error = std::max(partitions_error, part.last_error);
+        std::vector<uint32_t> to_merged(part.its.vertices.size());
+        for (size_t i = 0; i < part.its.vertices.size(); ++i) {
+            uint32_t gi = part.global_vertex[i];
+            uint32_t *mi = gi == std::numeric_limits<uint32_t>::max() ? nullptr : &global_to_merged[gi];
+            if (mi != nullptr && *mi != std::numeric_limits<uint32_t>::max()) {
+                to_merged[i] = *mi;
+            } else {
+                to_merged[i] = uint32_t(merged.vertices.size());
+                merged.vertices.emplace_back(part.its.vertices[i]);
+                if (mi != nullptr)
+                    *mi = to_merged[i];
+            }
+        }
+        for (Triangle t : part.its.indices) {
+            for (int &vi : t)
+                vi = int(to_merged[vi]);
+            merged.indices.emplace_back(t);
+        }
+        part = Part{};
+    }
+    its = std::move(merged);
+
+    // Final pass collapses the seams between partitions and the rest to the wanted triangle count.
+    float final_error = (max_error == nullptr) ? std::numeric_limits<float>::max() : *max_error;
+    StatusFn final_status_fn = [&status_fn](int percent) {
+        status_fn(status_partitions_size + percent * (100 - status_partitions_size) / 100);
+    };
+    if (its.indices.size() > triangle_count)
+        collapse(its, triangle_count, &final_error, throw_on_cancel, final_status_fn);
+    else
+        final_error = 0.f;
+    status_fn(100);
+    if (max_error != nullptr)
+        *max_error = std::max(partitions_error, final_error);
+}
+
+std::vector<std::vector<uint32_t>> QuadricEdgeCollapse::create_partitions(const indexed_triangle_set &its, uint32_t max_partition_size)
+{
+    std::vector<Vec3f> centroids(its.indices.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, its.indices.size()), [&](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++i) {
+            const Triangle &t = its.indices[i];
+            centroids[i] = (its.vertices[t[0]] + its.vertices[t[1]] + its.vertices[t[2]]) / 3.f;
+        }
+    });
+
+    std::vector<uint32_t> triangles(its.indices.size());
+    std::iota(triangles.begin(), triangles.end(), 0);
+
+    // Recursive median split of the centroids by the longest axis, the triangle index breaks ties
+    // so that the partitions do not depend on the std::nth_element() implementation.
+    std::vector<std::vector<uint32_t>> partitions;
+    std::function<void(std::vector<uint32_t>::iterator, std::vector<uint32_t>::iterator)> split =
+        [&](std::vector<uint32_t>::iterator begin, std::vector<uint32_t>::iterator end) {
+        if (size_t(end - begin) <= max_partition_size) {
+            partitions.emplace_back(begin, end);
+            std::sort(partitions.back().begin(), partitions.back().end());
+            return;
+        }
+        Vec3f min = centroids[*begin], max = min;
+        for (auto it = begin; it != end; ++it) {
+            min = min.cwiseMin(centroids[*it]);
+            max = max.cwiseMax(centroids[*it]);
+        }
+        int axis;
+        (max - min).maxCoeff(&axis);
+        auto mid = begin + (end - begin) / 2;
+        std::nth_element(begin, mid, end, [&centroids, axis](uint32_t t1, uint32_t t2) {
+            float c1 = centroids[t1][axis], c2 = centroids[t2][axis];
+            return c1 < c2 || (c1 == c2 && t1 < t2);
+        });
+        split(begin, mid);
+        split(mid, end);
+    };
+    split(triangles.begin(), triangles.end());
+    return partitions;
+}
+
+void QuadricEdgeCollapse::collapse(
+    indexed_triangle_set &    its,
+    uint32_t                  triangle_count,
+    float *                   max_error,
+    ThrowOnCancel             throw_on_cancel,
+    StatusFn                  status_fn,
+    const LockedVertices &    locked,
+    std::vector<uint32_t> *   new_vertex_indices)
 {
     // check input
     if (triangle_count >= its.indices.size()) return;
@@ -184,7 +393,7 @@ void Slic3r::its_quadric_edge_collapse(
     VertexInfos   v_infos;
     EdgeInfos     e_infos;
     Errors        errors;
-    std::tie(t_infos, v_infos, e_infos, errors) = init(its, throw_on_cancel, init_status_fn);
+    std::tie(t_infos, v_infos, e_infos, errors) = init(its, locked, throw_on_cancel, init_status_fn);
     throw_on_cancel();
     status_fn(status_init_size);
 
@@ -266,7 +475,7 @@ void Slic3r::its_quadric_edge_collapse(
             is_flipped(new_vertex0, ti0, ti1, v_info0, t_infos, e_infos, its) ||
             is_flipped(new_vertex0, ti0, ti1, v_info1, t_infos, e_infos, its)) {
             // try other triangle's edge
-            Vec3d errors = calculate_3errors(t0, its.vertices, v_infos);
+            Vec3d errors = calculate_3errors(t0, its.vertices, v_infos, locked);
             Vec3i32 ord = (errors[0] < errors[1]) ? 
                 ((errors[0] < errors[2])? 
                     ((errors[1] < errors[2]) ? Vec3i32(0, 1, 2) : Vec3i32(0, 2, 1)) :
@@ -330,7 +539,7 @@ void Slic3r::its_quadric_edge_collapse(
             size_t priority_queue_index = ti_2_mpqi[ti];
             TriangleInfo& t_info = t_infos[ti];
             t_info.n = create_normal(its.indices[ti], its.vertices).cast<float>(); // recalc normals
-            mpq[priority_queue_index] = calculate_error(ti, its.indices[ti], its.vertices, v_infos, t_info.min_index);
+            mpq[priority_queue_index] = calculate_error(ti, its.indices[ti], its.vertices, v_infos, locked, t_info.min_index);
             mpq.update(priority_queue_index);
         }
 
@@ -346,7 +555,7 @@ void Slic3r::its_quadric_edge_collapse(
     }
 
     // compact triangle
-    compact(v_infos, t_infos, e_infos, its);
+    compact(v_infos, t_infos, e_infos, its, new_vertex_indices);
     if (max_error != nullptr) *max_error = last_collapsed_error;
 }
 
@@ -442,7 +651,7 @@ SymMat QuadricEdgeCollapse::create_quadric(const Triangle &t,
 }
 
 std::tuple<TriangleInfos, VertexInfos, EdgeInfos, Errors> 
-QuadricEdgeCollapse::init(const indexed_triangle_set &its, ThrowOnCancel& throw_on_cancel, StatusFn& status_fn)
+QuadricEdgeCollapse::init(const indexed_triangle_set &its, const LockedVertices &locked, ThrowOnCancel& throw_on_cancel, StatusFn& status_fn)
 {
     int status_offset = 0;
     TriangleInfos t_infos(its.indices.size());
@@ -504,7 +713,7 @@ QuadricEdgeCollapse::init(const indexed_triangle_set &its, ThrowOnCancel& throw_
         for (size_t i = range.begin(); i < range.end(); ++i) {
             const Triangle &t      = its.indices[i];
             TriangleInfo &  t_info = t_infos[i];
-            errors[i] = calculate_error(i, t, its.vertices, v_infos, t_info.min_index);
+            errors[i] = calculate_error(i, t, its.vertices, v_infos, locked, t_info.min_index);
             if (i % 1000000 == 0) {
                 throw_on_cancel();
                 status_fn(status_offset + (i * status_calc_errors) / its.indices.size());
@@ -702,15 +911,21 @@ bool QuadricEdgeCollapse::create_no_volume(
     return false;
 }
 
-Vec3d QuadricEdgeCollapse::calculate_3errors(const Triangle &   t,
-                                             const Vertices &   vertices,
-                                             const VertexInfos &v_infos)
+Vec3d QuadricEdgeCollapse::calculate_3errors(const Triangle &      t,
+                                             const Vertices &      vertices,
+                                             const VertexInfos &   v_infos,
+                                             const LockedVertices &locked)
 {
     Vec3d error;
     for (size_t j = 0; j < 3; ++j) {
         size_t   j2  = (j == 2) ? 0 : (j + 1);
         uint32_t vi0 = t[j];
         uint32_t vi1 = t[j2];
+        if (! locked.empty() && (locked[vi0] || locked[vi1])) {
+            // locked edge is never collapsed
+            error[j] = std::numeric_limits<float>::max();
+            continue;
+        }
         SymMat   q(v_infos[vi0].q); // copy
         q += v_infos[vi1].q;
         error[j] = calculate_error(vi0, vi1, q, vertices);
@@ -718,13 +933,14 @@ Vec3d QuadricEdgeCollapse::calculate_3errors(const Triangle &   t,
     return error;
 }
 
-Error QuadricEdgeCollapse::calculate_error(uint32_t           ti,
-                                           const Triangle &   t,
-                                           const Vertices &   vertices,
-                                           const VertexInfos &v_infos,
-                                           unsigned char &    min_index)
+Error QuadricEdgeCollapse::calculate_error(uint32_t              ti,
+                                           const Triangle &      t,
+                                           const Vertices &      vertices,
+                                           const VertexInfos &   v_infos,
+                                           const LockedVertices &locked,
+                                           unsigned char &       min_index)
 {
-    Vec3d error = calculate_3errors(t, vertices, v_infos);
+    Vec3d error = calculate_3errors(t, vertices, v_infos, locked);
     // select min error
     min_index = (error[0] < error[1]) ? ((error[0] < error[2]) ? 0 : 2) :
                                         ((error[1] < error[2]) ? 1 : 2);
@@ -837,15 +1053,20 @@ void QuadricEdgeCollapse::change_neighbors(EdgeInfos &     e_infos,
     }
 }
 
-void QuadricEdgeCollapse::compact(const VertexInfos &   v_infos,
-                                  const TriangleInfos & t_infos,
-                                  const EdgeInfos &     e_infos,
-                                  indexed_triangle_set &its)
+void QuadricEdgeCollapse::compact(const VertexInfos &    v_infos,
+                                  const TriangleInfos &  t_infos,
+                                  const EdgeInfos &      e_infos,
+                                  indexed_triangle_set & its,
+                                  std::vector<uint32_t> *new_vertex_indices)
 {
+    if (new_vertex_indices != nullptr)
+        new_vertex_indices->assign(v_infos.size(), std::numeric_limits<uint32_t>::max());
     uint32_t vi_new = 0;
     for (uint32_t vi = 0; vi < v_infos.size(); ++vi) {
         const VertexInfo &v_info = v_infos[vi];
         if (v_info.is_deleted()) continue; // deleted
+        if (new_vertex_indices != nullptr)
+            (*new_vertex_indices)[vi] = vi_new;
         uint32_t e_info_end = v_info.start + v_info.count;
         for (uint32_t ei = v_info.start; ei < e_info_end; ++ei) { 
             const EdgeInfo &e_info = e_infos[ei];
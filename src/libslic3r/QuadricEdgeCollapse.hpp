@@ -34,6 +34,24 @@ void its_quadric_edge_collapse(
     std::function<void(void)> throw_on_cancel = nullptr,
     std::function<void(int)>  statusfn        = nullptr);
 
+/// <summary>
+/// Simplify mesh by Quadric metric in parallel.
+/// Triangles are split into spatial partitions, which are simplified independently
+/// with the vertices on partition borders kept in place. The stitched mesh is
+/// then simplified once more to collapse the borders and to reach the wanted triangle count.
+/// Result is deterministic, it does not depend on the count of threads.
+/// its_quadric_edge_collapse() calls it for big meshes.
+/// </summary>
+/// <param name="max_partition_size">Maximal count of triangles in one partition, 0 for default.</param>
+/// Other params are the same as for its_quadric_edge_collapse()
+void its_quadric_edge_collapse_partitioned(
+    indexed_triangle_set &    its,
+    uint32_t                  triangle_count     = 0,
+    float *                   max_error          = nullptr,
+    std::function<void(void)> throw_on_cancel    = nullptr,
+    std::function<void(int)>  statusfn           = nullptr,
+    uint32_t                  max_partition_size = 0);
+
 } // namespace Slic3r
 #endif // slic3r_quadric_edge_collapse_hpp_
 
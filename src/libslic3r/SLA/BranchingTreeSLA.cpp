@@ -14,15 +14,139 @@
 #include "Pad.hpp"
 
 #include <map>
+#include <array>
+#include <tuple>
+#include <unordered_map>
+
+#include <boost/functional/hash.hpp>
 
 namespace Slic3r { namespace sla {
 
 inline constexpr const auto &beam_ex_policy = ex_tbb;
 
+// Everything the cached mesh queries depend on, apart from the mesh itself.
+static auto cache_config(const SupportableMesh &sm)
+{
+    const SupportTreeConfig &c = sm.cfg;
+    return std::make_tuple(c.enabled, c.tree_type, c.head_front_radius_mm,
+                           c.head_penetration_mm, c.head_back_radius_mm,
+                           c.head_fallback_radius_mm, c.head_width_mm,
+                           c.pillar_connection_mode, c.ground_facing_only,
+                           c.pillar_widening_factor, c.base_radius_mm,
+                           c.base_height_mm, c.bridge_slope,
+                           c.max_bridge_length_mm,
+                           c.max_pillar_link_distance_mm,
+                           c.object_elevation_mm,
+                           c.pillar_base_safety_distance_mm,
+                           c.max_bridges_on_pillar,
+                           c.max_weight_on_model_support, ground_level(sm));
+}
+
+// Results of the mesh queries done while building a branching tree. Each
+// query is keyed by its exact input geometry, so the results stay valid for
+// any support points on the same mesh with the same config. Editing a few
+// support points then only queries the pinheads and branches around them.
+class BranchingTreeCache
+{
+    template<class V, size_t N> class Queries
+    {
+    public:
+        using Key = std::array<double, N>;
+
+        template<class Fn> V get(const Key &key, Fn &&fn)
+        {
+            {
+                std::lock_guard lk{m_mtx};
+                if (auto it = m_map.find(key); it != m_map.end()) {
+                    it->second.used = true;
+                    return it->second.value;
+                }
+            }
+
+            V value = fn();
+
+            std::lock_guard lk{m_mtx};
+            m_map.insert_or_assign(key, Entry{value, true});
+
+            return value;
+        }
+
+        void clear() { m_map.clear(); }
+
+        // Drop the results not used since the last call
+        void prune()
+        {
+            for (auto it = m_map.begin(); it != m_map.end();)
+                if (it->second.used) {
+                    it->second.used = false;
+                    ++it;
+                } else
+                    it = m_map.erase(it);
+        }
+
+    private:
+        struct KeyHash
+        {
+            size_t operator()(const Key &key) const
+            {
+                return boost::hash_range(key.begin(), key.end());
+            }
+        };
+
+        struct Entry
+        {
+            V    value;
+            bool used;
+        };
+
+        std::unordered_map<Key, Entry, KeyHash> m_map;
+        execution::SpinningMutex<ExecutionTBB>  m_mtx;
+    };
+
+    std::optional<decltype(cache_config(std::declval<SupportableMesh>()))> m_config;
+
+public:
+    // Pinheads by support point position and head radius
+    Queries<std::optional<Head>, 4> pinheads;
+
+    // Ground routes by source junction, end radius and initial direction
+    Queries<GroundConnection, 8> ground_connections;
+
+    // Model anchors by source junction and target point
+    Queries<std::optional<Anchor>, 7> anchors;
+
+    // Distance of the first hit of a beam by its balls and safety distance
+    Queries<double, 9> beam_hits;
+
+    // Drop all the results if the config changed since the last build
+    void update_config(const SupportableMesh &sm)
+    {
+        auto cfg = cache_config(sm);
+        if (!m_config || *m_config != cfg) {
+            pinheads.clear();
+            ground_connections.clear();
+            anchors.clear();
+            beam_hits.clear();
+            m_config = cfg;
+        }
+    }
+
+    // Keep only the results used by the last build, so that the cache does
+    // not grow with each edit of the support points.
+    void prune()
+    {
+        pinheads.prune();
+        ground_connections.prune();
+        anchors.prune();
+        beam_hits.prune();
+    }
+};
+
 class BranchingTreeBuilder: public branchingtree::Builder {
     SupportTreeBuilder &m_builder;
     const SupportableMesh  &m_sm;
     const branchingtree::PointCloud &m_cloud;
+    BranchingTreeCache &m_cache;
 
     std::vector<branchingtree::Node> m_pillars; // to put an index over them
 
@@ -43,6 +167,30 @@ class BranchingTreeBuilder: public branchingtree::Builder {
 
     std::vector<size_t>  m_unroutable_pinheads;
 
+    double beam_hit_distance(const Ball &from, const Ball &to, double sd) const
+    {
+        return m_cache.beam_hits.get(
+            {from.p.x(), from.p.y(), from.p.z(), from.R, to.p.x(), to.p.y(),
+             to.p.z(), to.R, sd},
+            [this, &from, &to, sd] {
+                return beam_mesh_hit(beam_ex_policy, m_sm.emesh, Beam{from, to}, sd)
+                    .distance();
+            });
+    }
+
+    GroundConnection search_ground_connection(const sla::Junction &j,
+                                              double end_radius,
+                                              const Vec3d &init_dir) const
+    {
+        return m_cache.ground_connections.get(
+            {j.pos.x(), j.pos.y(), j.pos.z(), j.r, end_radius, init_dir.x(),
+             init_dir.y(), init_dir.z()},
+            [this, &j, end_radius, &init_dir] {
+                return deepsearch_ground_connection(beam_ex_policy, m_sm, j,
+                                                    end_radius, init_dir);
+            });
+    }
+
     void build_subtree(size_t root)
     {
         traverse(m_cloud, root, [this](const branchingtree::Node &node) {
@@ -131,8 +279,9 @@ class BranchingTreeBuilder: public branchingtree::Builder {
 public:
     BranchingTreeBuilder(SupportTreeBuilder          &builder,
                      const SupportableMesh       &sm,
-                     const branchingtree::PointCloud &cloud)
-        : m_builder{builder}, m_sm{sm}, m_cloud{cloud}
+                     const branchingtree::PointCloud &cloud,
+                     BranchingTreeCache          &cache)
+        : m_builder{builder}, m_sm{sm}, m_cloud{cloud}, m_cache{cache}
     {}
 
     bool add_bridge(const branchingtree::Node &from,
@@ -194,11 +343,10 @@ bool BranchingTreeBuilder::add_bridge(const branchingtree::Node &from,
 {
     Vec3d fromd = from.pos.cast<double>(), tod = to.pos.cast<double>();
     double fromR = get_radius(from), toR = get_radius(to);
-    Beam beam{Ball{fromd, fromR}, Ball{tod, toR}};
-    auto   hit = beam_mesh_hit(beam_ex_policy , m_sm.emesh, beam,
-                               m_sm.cfg.safety_distance_mm);
+    double hit_distance = beam_hit_distance(Ball{fromd, fromR}, Ball{tod, toR},
+                                            m_sm.cfg.safety_distance_mm);
 
-    bool ret = hit.distance() > (tod - fromd).norm();
+    bool ret = hit_distance > (tod - fromd).norm();
 
     return ret;
 }
@@ -214,15 +362,12 @@ bool BranchingTreeBuilder::add_merger(const branchingtree::Node &node,
     double mergeR   = get_radius(merge_node);
     double nodeR    = get_radius(node);
     double closestR = get_radius(closest);
-    Beam beam1{Ball{from1d, nodeR}, Ball{tod, mergeR}};
-    Beam beam2{Ball{from2d, closestR}, Ball{tod, mergeR}};
-
     auto sd = m_sm.cfg.safety_distance_mm ;
-    auto hit1 = beam_mesh_hit(beam_ex_policy , m_sm.emesh, beam1, sd);
-    auto hit2 = beam_mesh_hit(beam_ex_policy , m_sm.emesh, beam2, sd);
+    double hit1 = beam_hit_distance(Ball{from1d, nodeR}, Ball{tod, mergeR}, sd);
+    double hit2 = beam_hit_distance(Ball{from2d, closestR}, Ball{tod, mergeR}, sd);
 
-    bool ret = hit1.distance() > (tod - from1d).norm() &&
-               hit2.distance() > (tod - from2d).norm();
+    bool ret = hit1 > (tod - from1d).norm() &&
+               hit2 > (tod - from2d).norm();
 
     return ret;
 }
@@ -241,8 +386,7 @@ bool BranchingTreeBuilder::add_ground_bridge(const branchingtree::Node &from,
         sla::Junction j{from.pos.cast<double>(), get_radius(from)};
         Vec3d init_dir = (to.pos - from.pos).cast<double>().normalized();
 
-        auto conn = deepsearch_ground_connection(beam_ex_policy , m_sm, j,
-                                                 get_radius(to), init_dir);
+        auto conn = search_ground_connection(j, get_radius(to), init_dir);
 
         // Remember that this node was tested if can go to ground, don't
         // test it with any other destination ground point because
@@ -269,18 +413,24 @@ bool BranchingTreeBuilder::add_mesh_bridge(const branchingtree::Node &from,
 
     sla::Junction fromj = {from.pos.cast<double>(), get_radius(from)};
 
+    Vec3d tod = to.pos.cast<double>();
     auto anchor = m_sm.cfg.ground_facing_only ?
                       std::optional<Anchor>{} : // If no mesh connections are allowed
-                      calculate_anchor_placement(beam_ex_policy , m_sm, fromj,
-                                                 to.pos.cast<double>());
+                      m_cache.anchors.get(
+                          {fromj.pos.x(), fromj.pos.y(), fromj.pos.z(), fromj.r,
+                           tod.x(), tod.y(), tod.z()},
+                          [this, &fromj, &tod] {
+                              return calculate_anchor_placement(beam_ex_policy, m_sm,
+                                                                fromj, tod);
+                          });
 
     if (anchor) {
         sla::Junction toj = {anchor->junction_point(), anchor->r_back_mm};
 
-        auto hit = beam_mesh_hit(beam_ex_policy , m_sm.emesh,
-                                 Beam{{fromj.pos, fromj.r}, {toj.pos, toj.r}}, 0.);
+        double hit_distance = beam_hit_distance(Ball{fromj.pos, fromj.r},
+                                                Ball{toj.pos, toj.r}, 0.);
 
-        if (hit.distance() > distance(fromj.pos, toj.pos)) {
+        if (hit_distance > distance(fromj.pos, toj.pos)) {
             m_builder.add_diffbridge(fromj.pos, toj.pos, fromj.r, toj.r);
             m_builder.add_anchor(*anchor);
 
@@ -332,8 +482,7 @@ std::optional<Vec3f> BranchingTreeBuilder::suggest_avoidance(
     if (found_it != m_gnd_connections.end()) {
         ret = get_avoidance(found_it->second, max_bridge_len);
     } else {
-        auto conn = deepsearch_ground_connection(
-            beam_ex_policy , m_sm, j, get_radius(dst), sla::DOWN);
+        auto conn = search_ground_connection(j, get_radius(dst), sla::DOWN);
 
         {
             std::lock_guard lk{m_gnd_connections_mtx};
@@ -359,6 +508,12 @@ inline void build_pillars(SupportTreeBuilder &builder,
 
 void create_branching_tree(SupportTreeBuilder &builder, const SupportableMesh &sm)
 {
+    if (!sm.branching_tree_cache)
+        sm.branching_tree_cache = std::make_shared<BranchingTreeCache>();
+
+    BranchingTreeCache &cache = *sm.branching_tree_cache;
+    cache.update_config(sm);
+
     auto coordfn = [&sm](size_t id, size_t dim) { return sm.pts[id].pos(dim); };
     KDTreeIndirect<3, float, decltype (coordfn)> tree{coordfn, sm.pts.size()};
 
@@ -368,9 +523,15 @@ void create_branching_tree(SupportTreeBuilder &builder, const SupportableMesh &s
 
     execution::for_each(
         ex_tbb, size_t(0), nondup_idx.size(),
-        [&sm, &heads, &nondup_idx, &builder](size_t i) {
-            if (!builder.ctl().stopcondition())
-                heads[i] = calculate_pinhead_placement(ex_seq, sm, nondup_idx[i]);
+        [&sm, &heads, &nondup_idx, &builder, &cache](size_t i) {
+            if (!builder.ctl().stopcondition()) {
+                const SupportPoint &sp = sm.pts[nondup_idx[i]];
+                heads[i] = cache.pinheads.get(
+                    {sp.pos.x(), sp.pos.y(), sp.pos.z(), sp.head_front_radius},
+                    [&sm, &nondup_idx, i] {
+                        return calculate_pinhead_placement(ex_seq, sm, nondup_idx[i]);
+                    });
+            }
         },
         execution::max_concurrency(ex_tbb)
     );
@@ -409,7 +570,7 @@ void create_branching_tree(SupportTreeBuilder &builder, const SupportableMesh &s
     branchingtree::PointCloud nodes{std::move(meshpts), std::move(bedpts),
                                     std::move(leafs), props};
 
-    BranchingTreeBuilder vbuilder{builder, sm, nodes};
+    BranchingTreeBuilder vbuilder{builder, sm, nodes, cache};
 
     execution::for_each(ex_tbb,
                         size_t(0),
@@ -426,6 +587,9 @@ void create_branching_tree(SupportTreeBuilder &builder, const SupportableMesh &s
     for (size_t id : vbuilder.unroutable_pinheads())
         builder.head(id).invalidate();
 
+    if (!builder.ctl().stopcondition())
+        cache.prune();
+
 }
 
 }} // namespace Slic3r::sla
@@ -85,21 +85,37 @@ InteriorPtr generate_interior(const VoxelGrid       &vgrid,
     if (ctl.stopcondition()) return {};
     else ctl.statuscb(0, _u8L("Hollowing"));
 
-    auto gridptr = dilate_grid(vgrid, out_range, in_range);
+    double iso_surface = D > EPSILON ? D : -offset;
 
-    if (ctl.stopcondition()) return {};
-    else ctl.statuscb(30, _u8L("Hollowing"));
+    // The interior is only computed in a band of the wall thickness and closing
+    // distance around the surface, a voxel is not affected by the surface
+    // further than that. This allows to hollow the grid in independent slabs.
+    auto hollow_slab = [&](const VoxelGrid &slab) -> VoxelGridPtr {
+        if (ctl.stopcondition()) return {};
 
-    double iso_surface = D;
-    if (D > EPSILON) {
-        gridptr = redistance_grid(*gridptr, -(offset + D), narrowb, narrowb);
+        auto gridptr = dilate_grid(slab, out_range, in_range);
+
+        if (ctl.stopcondition()) return {};
+
+        if (D > EPSILON) {
+            gridptr = redistance_grid(*gridptr, -(offset + D), narrowb, narrowb);
+            gridptr = dilate_grid(*gridptr, 1.1 * std::ceil(iso_surface), 0.f);
+        }
 
-        gridptr = dilate_grid(*gridptr, 1.1 * std::ceil(iso_surface), 0.f);
+        return gridptr;
+    };
+
+    double halo = in_range + out_range + 3. / voxsc;
+    if (D > EPSILON)
+        halo += 1.1 * std::ceil(iso_surface) + 2. * narrowb / voxsc;
+
+    auto gridptr = process_grid_in_slabs(vgrid, float(halo), hc.max_slabs, hollow_slab);
 
+    if (!gridptr) return {};
+
+    if (D > EPSILON) {
         out_range = iso_surface;
         in_range  = narrowb / voxsc;
-    } else {
-        iso_surface = -offset;
     }
 
     if (ctl.stopcondition()) return {};
@@ -23,6 +23,9 @@ struct HollowingConfig
     double quality          = 0.5;
     double closing_distance = 0.5;
     bool enabled = true;
+    // Upper limit of the slabs hollowed in parallel, 0 for the available
+    // concurrency, 1 to hollow the whole grid at once.
+    size_t max_slabs = 0;
 };
 
 enum HollowingFlags { hfRemoveInsideTriangles = 0x1 };
@@ -17,6 +17,7 @@
 #include "libslic3r.h"
 
 #include <iostream>
+#include <numeric>
 #include <random>
 
 namespace Slic3r {
@@ -225,6 +226,51 @@ static std::vector<SupportPointGenerator::MyLayer> make_layers(
     return layers;
 }
 
+// Split islands of a layer into clusters of islands, which are closer than radius to each other.
+static std::vector<SupportPointGenerator::IslandCluster> make_island_clusters(
+    const std::vector<SupportPointGenerator::Structure> &islands, coord_t radius)
+{
+    std::vector<size_t> parent(islands.size());
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find_root = [&parent](size_t i) {
+        while (parent[i] != i)
+            i = parent[i] = parent[parent[i]];
+        return i;
+    };
+
+    // Sweep over the islands sorted by the left side of their bounding boxes.
+    std::vector<size_t> sorted(islands.size());
+    std::iota(sorted.begin(), sorted.end(), 0);
+    std::sort(sorted.begin(), sorted.end(), [&islands](size_t i, size_t j) {
+        return islands[i].bbox.min.x() < islands[j].bbox.min.x();
+    });
+    std::vector<size_t> active;
+    for (size_t i : sorted) {
+        BoundingBox bbox = islands[i].bbox;
+        bbox.offset(radius);
+        active.erase(std::remove_if(active.begin(), active.end(),
+                                    [&islands, &bbox](size_t j) { return islands[j].bbox.max.x() < bbox.min.x(); }),
+                     active.end());
+        for (size_t j : active)
+            if (bbox.overlap(islands[j].bbox))
+                parent[find_root(i)] = find_root(j);
+        active.emplace_back(i);
+    }
+
+    // Clusters are ordered by their first island, islands of a cluster keep their order.
+    std::vector<SupportPointGenerator::IslandCluster> clusters;
+    std::vector<size_t> root_cluster(islands.size(), std::numeric_limits<size_t>::max());
+    for (size_t i = 0; i < islands.size(); ++ i) {
+        size_t &cluster_idx = root_cluster[find_root(i)];
+        if (cluster_idx == std::numeric_limits<size_t>::max()) {
+            cluster_idx = clusters.size();
+            clusters.emplace_back();
+        }
+        clusters[cluster_idx].islands.emplace_back(i);
+    }
+    return clusters;
+}
+
 void SupportPointGenerator::process(const std::vector<ExPolygons>& slices, const std::vector<float>& heights)
 {
 #ifdef SLA_SUPPORTPOINTGEN_DEBUG
@@ -235,6 +281,8 @@ void SupportPointGenerator::process(const std::vector<ExPolygons>& slices, const
 
     PointGrid3D point_grid;
     point_grid.cell_size = Vec3f(10.f, 10.f, 10.f);
+    // Islands further from each other than the sampling radius cannot place colliding points.
+    const coord_t cluster_radius = scaled(this->poisson_radius()) + SCALED_EPSILON;
 
     double increment = 100.0 / layers.size();
     double status    = 0;
@@ -272,12 +320,26 @@ void SupportPointGenerator::process(const std::vector<ExPolygons>& slices, const
                     above_link.island->supports_force_inherited += below_support_force * above_link.overlap_area / above_overlap_area;
             }
         }
-        // Now iterate over all polygons and append new points if needed.
-        for (Structure &s : layer_top->islands) {
+        for (Structure &s : layer_top->islands)
             // Penalization resulting from large diff from the last layer:
             s.supports_force_inherited /= std::max(1.f, 0.17f * (s.overhangs_area) / s.area);
 
-            add_support_points(s, point_grid);
+        // Now iterate over all polygons and append new points if needed.
+        // Distant islands are independent, only the islands of one cluster are processed in sequence.
+        std::vector<IslandCluster> clusters = make_island_clusters(layer_top->islands, cluster_radius);
+        for (IslandCluster &cluster : clusters) {
+            cluster.grid.cell_size = point_grid.cell_size;
+            cluster.grid.base      = &point_grid;
+            cluster.rng.seed(m_rng());
+        }
+        execution::for_each(ex_tbb, size_t(0), clusters.size(), [this, layer_top, &clusters](size_t cluster_idx) {
+            IslandCluster &cluster = clusters[cluster_idx];
+            for (size_t island_idx : cluster.islands)
+                add_support_points(layer_top->islands[island_idx], cluster);
+        });
+        for (IslandCluster &cluster : clusters) {
+            append(m_output, std::move(cluster.points));
+            point_grid.grid.insert(cluster.grid.grid.begin(), cluster.grid.grid.end());
         }
 
         m_throw_on_cancel();
@@ -295,7 +357,7 @@ void SupportPointGenerator::process(const std::vector<ExPolygons>& slices, const
     }
 }
 
-void SupportPointGenerator::add_support_points(SupportPointGenerator::Structure &s, SupportPointGenerator::PointGrid3D &grid3d)
+void SupportPointGenerator::add_support_points(SupportPointGenerator::Structure &s, SupportPointGenerator::IslandCluster &cluster)
 {
     // Select each type of surface (overrhang, dangling, slope), derive the support
     // force deficit for it and call uniformly conver with the right params
@@ -306,12 +368,12 @@ void SupportPointGenerator::add_support_points(SupportPointGenerator::Structure
     if (s.islands_below.empty()) {
         // completely new island - needs support no doubt
         // deficit is full, there is nothing below that would hold this island
-        uniformly_cover({ *s.polygon }, s, s.area * tp, grid3d, IslandCoverageFlags(icfIsNew | icfWithBoundary) );
+        uniformly_cover({ *s.polygon }, s, s.area * tp, cluster, IslandCoverageFlags(icfIsNew | icfWithBoundary) );
         return;
     }
 
     if (! s.overhangs.empty()) {
-        uniformly_cover(s.overhangs, s, s.overhangs_area * tp, grid3d);
+        uniformly_cover(s.overhangs, s, s.overhangs_area * tp, cluster);
     }
 
     auto areafn = [](double sum, auto &p) { return sum + p.area() * SCALING_FACTOR * SCALING_FACTOR; };
@@ -322,13 +384,13 @@ void SupportPointGenerator::add_support_points(SupportPointGenerator::Structure
         // What we now have in polygons needs support, regardless of what the forces are, so we can add them.
 
         double a = std::accumulate(s.dangling_areas.begin(), s.dangling_areas.end(), 0., areafn);
-        uniformly_cover(s.dangling_areas, s, a * tp - a * current * s.area, grid3d, icfWithBoundary);
+        uniformly_cover(s.dangling_areas, s, a * tp - a * current * s.area, cluster, icfWithBoundary);
     }
 
     current = s.supports_force_total();
     if (! s.overhangs_slopes.empty()) {
         double a = std::accumulate(s.overhangs_slopes.begin(), s.overhangs_slopes.end(), 0., areafn);
-        uniformly_cover(s.overhangs_slopes, s, a * tp - a * current / s.area, grid3d, icfWithBoundary);
+        uniformly_cover(s.overhangs_slopes, s, a * tp - a * current / s.area, cluster, icfWithBoundary);
     }
 }
 
@@ -543,7 +605,14 @@ static inline std::vector<Vec2f> poisson_disk_from_samples(const std::vector<Vec
 }
 
 
-void SupportPointGenerator::uniformly_cover(const ExPolygons& islands, Structure& structure, float deficit, PointGrid3D &grid3d, IslandCoverageFlags flags)
+float SupportPointGenerator::poisson_radius() const
+{
+    const float density_horizontal = m_config.tear_pressure() / m_config.support_force();
+    //FIXME why?
+    return std::max(m_config.minimal_distance, 1.f / (5.f * density_horizontal));
+}
+
+void SupportPointGenerator::uniformly_cover(const ExPolygons& islands, Structure& structure, float deficit, IslandCluster &cluster, IslandCoverageFlags flags)
 {
     //int num_of_points = std::max(1, (int)((island.area()*pow(SCALING_FACTOR, 2) * m_config.tear_pressure)/m_config.support_force));
 
@@ -567,9 +636,7 @@ void SupportPointGenerator::uniformly_cover(const ExPolygons& islands, Structure
     // Number of newly added points.
     const size_t poisson_samples_target = size_t(ceil(support_force_deficit / m_config.support_force()));
 
-    const float density_horizontal = m_config.tear_pressure() / m_config.support_force();
-    //FIXME why?
-    float poisson_radius		= std::max(m_config.minimal_distance, 1.f / (5.f * density_horizontal));
+    float poisson_radius		= this->poisson_radius();
 //    const float poisson_radius     = 1.f / (15.f * density_horizontal);
     const float samples_per_mm2 = 30.f / (float(M_PI) * poisson_radius * poisson_radius);
     // Minimum distance between samples, in 3D space.
@@ -581,14 +648,14 @@ void SupportPointGenerator::uniformly_cover(const ExPolygons& islands, Structure
     std::vector<Vec2f> raw_samples =
         flags & icfWithBoundary ?
             sample_expolygon_with_boundary(islands, samples_per_mm2,
-                                           5.f / poisson_radius, m_rng) :
-            sample_expolygon(islands, samples_per_mm2, m_rng);
+                                           5.f / poisson_radius, cluster.rng) :
+            sample_expolygon(islands, samples_per_mm2, cluster.rng);
 
     std::vector<Vec2f>  poisson_samples;
     for (size_t iter = 0; iter < 4; ++ iter) {
         poisson_samples = poisson_disk_from_samples(raw_samples, poisson_radius,
-            [&structure, &grid3d, min_spacing](const Vec2f &pos) {
-                return grid3d.collides_with(pos, structure.layer->print_z, min_spacing);
+            [&structure, &cluster, min_spacing](const Vec2f &pos) {
+                return cluster.grid.collides_with(pos, structure.layer->print_z, min_spacing);
             });
         if (poisson_samples.size() >= poisson_samples_target || m_config.minimal_distance > poisson_radius-EPSILON)
             break;
@@ -614,13 +681,13 @@ void SupportPointGenerator::uniformly_cover(const ExPolygons& islands, Structure
 
 //    assert(! poisson_samples.empty());
     if (poisson_samples_target < poisson_samples.size()) {
-        std::shuffle(poisson_samples.begin(), poisson_samples.end(), m_rng);
+        std::shuffle(poisson_samples.begin(), poisson_samples.end(), cluster.rng);
         poisson_samples.erase(poisson_samples.begin() + poisson_samples_target, poisson_samples.end());
     }
     for (const Vec2f &pt : poisson_samples) {
-        m_output.emplace_back(float(pt(0)), float(pt(1)), structure.zlevel, m_config.head_diameter/2.f, flags & icfIsNew);
+        cluster.points.emplace_back(float(pt(0)), float(pt(1)), structure.zlevel, m_config.head_diameter/2.f, flags & icfIsNew);
         structure.supports_force_this_layer += m_config.support_force();
-        grid3d.insert(pt, &structure);
+        cluster.grid.insert(pt, &structure);
     }
 }
 
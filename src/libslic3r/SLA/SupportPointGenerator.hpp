@@ -150,8 +150,10 @@ public:
         
         Vec3f   cell_size;
         Grid    grid;
+        // Points of this grid are tested for collisions as well, it is not modified through this grid.
+        const PointGrid3D *base = nullptr;
         
-        Vec3i32 cell_id(const Vec3f &pos) {
+        Vec3i32 cell_id(const Vec3f &pos) const {
             return Vec3i32(int(floor(pos.x() / cell_size.x())),
                          int(floor(pos.y() / cell_size.y())),
                          int(floor(pos.z() / cell_size.z())));
@@ -164,7 +166,9 @@ public:
             grid.emplace(cell_id(pt.position), pt);
         }
         
-        bool collides_with(const Vec2f &pos, float print_z, float radius) {
+        bool collides_with(const Vec2f &pos, float print_z, float radius) const {
+            if (base != nullptr && base->collides_with(pos, print_z, radius))
+                return true;
             Vec3f pos3d(pos.x(), pos.y(), print_z);
             Vec3i32 cell = cell_id(pos3d);
             std::pair<Grid::const_iterator, Grid::const_iterator> it_pair = grid.equal_range(cell);
@@ -183,7 +187,7 @@ public:
         }
         
     private:
-        bool collides_with(const Vec3f &pos, float radius, Grid::const_iterator it_begin, Grid::const_iterator it_end) {
+        bool collides_with(const Vec3f &pos, float radius, Grid::const_iterator it_begin, Grid::const_iterator it_end) const {
             for (Grid::const_iterator it = it_begin; it != it_end; ++ it) {
                 float dist2 = (it->second.position - pos).squaredNorm();
                 if (dist2 < radius * radius)
@@ -193,6 +197,17 @@ public:
         }
     };
     
+    // Islands of one layer which are too close to each other to be covered independently.
+    // The clusters of a layer are covered in parallel, each one by a single thread.
+    struct IslandCluster {
+        std::vector<size_t>       islands;
+        // Points placed into this cluster, the grid of the points below is its base.
+        PointGrid3D               grid;
+        std::vector<SupportPoint> points;
+        // Seeded in the order of clusters, so that the points do not depend on the scheduling.
+        std::mt19937              rng;
+    };
+    
     void execute(const std::vector<ExPolygons> &slices,
                  const std::vector<float> &     heights);
     
@@ -209,9 +224,12 @@ public:
 
 private:
 
-    void uniformly_cover(const ExPolygons& islands, Structure& structure, float deficit, PointGrid3D &grid3d, IslandCoverageFlags flags = icfNone);
+    // Initial radius of the poisson disk sampling in uniformly_cover(), samples are never closer to other points.
+    float poisson_radius() const;
+
+    void uniformly_cover(const ExPolygons& islands, Structure& structure, float deficit, IslandCluster &cluster, IslandCoverageFlags flags = icfNone);
 
-    void add_support_points(Structure& structure, PointGrid3D &grid3d);
+    void add_support_points(Structure& structure, IslandCluster &cluster);
 
     void project_onto_mesh(std::vector<SupportPoint>& points) const;
 
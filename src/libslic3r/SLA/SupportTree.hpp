@@ -114,6 +114,8 @@ struct SupportTreeConfig
 
 enum class MeshType { Support, Pad };
 
+class BranchingTreeCache;
+
 struct SupportableMesh
 {
     AABBMesh          emesh;
@@ -122,6 +124,10 @@ struct SupportableMesh
     PadConfig         pad_cfg;
     double            zoffset = 0.;
 
+    // Mesh queries of the last branching tree built on this mesh, reused by the
+    // next build for the support points and branches which did not change.
+    mutable std::shared_ptr<BranchingTreeCache> branching_tree_cache;
+
     explicit SupportableMesh(const indexed_triangle_set &trmsh,
                              const SupportPoints        &sp,
                              const SupportTreeConfig    &c)
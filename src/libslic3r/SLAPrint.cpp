@@ -745,35 +745,45 @@ void SLAPrint::process()
 
     std::array<double, slaposCount + slapsCount> step_times {};
 
+    // The objects are independent, their steps run concurrently.
+    // Each object executes its steps in order, the shared status is guarded by the mutex.
+    std::mutex status_mutex;
     auto apply_steps_on_objects =
-        [this, &st, &printsteps, &step_times, &bench]
+        [this, &st, &printsteps, &step_times, &status_mutex]
         (const std::vector<SLAPrintObjectStep> &steps)
     {
-        double incr = 0;
-        for (SLAPrintObject *po : m_objects) {
-            for (SLAPrintObjectStep step : steps) {
-
-                // Cancellation checking. Each step will check for
-                // cancellation on its own and return earlier gracefully.
-                // Just after it returns execution gets to this point and
-                // throws the canceled signal.
-                throw_if_canceled();
-
-                st += incr;
-
-                if (po->set_started(step)) {
-                    m_report_status(*this, st, printsteps.label(step));
-                    bench.start();
-                    printsteps.execute(step, *po);
-                    bench.stop();
-                    step_times[step] += bench.getElapsedSec();
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, m_objects.size(), 1),
+                          [&](const tbb::blocked_range<size_t> &range) {
+            for (size_t obj_idx = range.begin(); obj_idx < range.end(); ++ obj_idx) {
+                SLAPrintObject *po = m_objects[obj_idx];
+                decltype(bench) step_bench;
+                for (SLAPrintObjectStep step : steps) {
+
+                    // Cancellation checking. Each step will check for
+                    // cancellation on its own and return earlier gracefully.
+                    // Just after it returns execution gets to this point and
+                    // throws the canceled signal.
                     throw_if_canceled();
-                    po->set_done(step);
+
+                    if (po->set_started(step)) {
+                        {
+                            std::lock_guard<std::mutex> lk(status_mutex);
+                            m_report_status(*this, st, printsteps.label(step));
+                        }
+                        step_bench.start();
+                        printsteps.execute(step, *po);
+                        step_bench.stop();
+                        throw_if_canceled();
+                        po->set_done(step);
+                        std::lock_guard<std::mutex> lk(status_mutex);
+                        step_times[step] += step_bench.getElapsedSec();
+                    }
+
+                    std::lock_guard<std::mutex> lk(status_mutex);
+                    st += printsteps.progressrange(step);
                 }
-                
-                incr = printsteps.progressrange(step);
             }
-        }
+        });
     };
 
     apply_steps_on_objects(level1_obj_steps);
@@ -1273,6 +1283,7 @@ void SLAPrint::StatusReporter::operator()(SLAPrint &         p,
                                           uint16_t           flags,
                                           const std::string &logmsg)
 {
+    std::lock_guard<std::mutex> lk(m_mutex);
     m_st = st;
     BOOST_LOG_TRIVIAL(info)
         << st << "% " << msg << (logmsg.empty() ? "" : ": ") << logmsg
@@ -1292,6 +1303,23 @@ MeshBoolean::cgal::CGALMeshPtr get_cgalmesh(const CSGPartForStep &part)
     return part.cgalcache? clone(*part.cgalcache) : nullptr;
 }
 
+bool is_cgal_eligible(const CSGPartForStep &part)
+{
+    // mesh can be nullptr if this is a stack push or pull
+    if (!csg::get_mesh(part) && csg::get_stack_operation(part) != CSGStackOp::Continue)
+        return true;
+
+    if (!part.cgal_eligible) {
+        if (!part.cgalcache && csg::get_mesh(part))
+            part.cgalcache = csg::get_cgalmesh(static_cast<const csg::CSGPart&>(part));
+
+        // The checks are done on the cached mesh, no need to clone it.
+        part.cgal_eligible = detail_cgal::is_cgalmesh_eligible(part.cgalcache);
+    }
+
+    return *part.cgal_eligible;
+}
+
 } // namespace csg
 
 } // namespace Slic3r
@@ -6,8 +6,10 @@
 #ifndef slic3r_SLAPrint_hpp_
 #define slic3r_SLAPrint_hpp_
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
+#include <optional>
 #include <set>
 
 #include "PrintBase.hpp"
@@ -67,6 +69,8 @@ struct CSGPartForStep : public csg::CSGPart
 {
     SLAPrintObjectStep key;
     mutable MeshBoolean::cgal::CGALMeshPtr cgalcache;
+    // Result of the CGAL eligibility check of cgalcache, not known yet if empty.
+    mutable std::optional<bool> cgal_eligible;
 
     CSGPartForStep(SLAPrintObjectStep k, CSGPart &&p = {})
         : key{k}, CSGPart{std::move(p)}
@@ -76,6 +80,8 @@ struct CSGPartForStep : public csg::CSGPart
     {
         this->its_ptr = std::move(part.its_ptr);
         this->operation = part.operation;
+        this->cgalcache.reset();
+        this->cgal_eligible.reset();
 
         return *this;
     }
@@ -86,6 +92,7 @@ struct CSGPartForStep : public csg::CSGPart
 namespace csg {
 
 MeshBoolean::cgal::CGALMeshPtr get_cgalmesh(const CSGPartForStep &part);
+bool is_cgal_eligible(const CSGPartForStep &part);
 
 } // namespace csg
 
@@ -579,7 +586,9 @@ private:
     
     class StatusReporter
     {
-        double m_st = 0;
+        // Steps of more objects report their status concurrently.
+        std::atomic<double> m_st { 0 };
+        std::mutex          m_mutex;
         
     public:
         void operator()(SLAPrint &         p,
@@ -16,6 +16,7 @@
 
 #include <cmath>
 #include <cassert>
+#include <unordered_map>
 
 namespace Slic3r {
 
@@ -2132,12 +2133,26 @@ std::vector<const PrintInstance*> chain_print_object_instances(const Print &prin
     std::vector<std::pair<size_t, size_t>> instances;
     for (size_t i = 0; i < print.objects().size(); ++ i) {
     	const PrintObject &object = *print.objects()[i];
-    	for (size_t j = 0; j < object.instances().size(); ++ j) {
-    		// Sliced PrintObjects are centered, object.instances()[j].shift is the center of the PrintObject in G-code coordinates.
-        	object_reference_points.emplace_back(object.instances()[j].shift);
+    	for (size_t j = 0; j < object.instances().size(); ++ j)
         	instances.emplace_back(i, j);
-        }
     }
+    // The instances of a ModelObject equal to a preceding one are printed by the preceding one's PrintObject, see Print::apply().
+    // Keep them in the order of their ModelObjects, as if they had their own PrintObjects.
+    std::unordered_map<const ModelObject*, size_t> model_object_idx;
+    for (const ModelObject *model_object : print.model().objects)
+        model_object_idx.emplace(model_object, model_object_idx.size());
+    auto instance_model_object_idx = [&print, &model_object_idx](const std::pair<size_t, size_t> &inst) {
+        auto it = model_object_idx.find(print.objects()[inst.first]->instances()[inst.second].model_instance->get_object());
+        return it == model_object_idx.end() ? size_t(0) : it->second;
+    };
+    std::stable_sort(instances.begin(), instances.end(), [&instance_model_object_idx](const auto &l, const auto &r) {
+        size_t lidx = instance_model_object_idx(l), ridx = instance_model_object_idx(r);
+        return lidx < ridx || (lidx == ridx && l.first < r.first);
+    });
+    object_reference_points.reserve(instances.size());
+    for (const std::pair<size_t, size_t> &inst : instances)
+        // Sliced PrintObjects are centered, PrintInstance::shift is the center of the PrintObject in G-code coordinates.
+        object_reference_points.emplace_back(print.objects()[inst.first]->instances()[inst.second].shift);
 	auto segment_end_point = [&object_reference_points](size_t idx, bool /* first_point */) -> const Point& { return object_reference_points[idx]; };
 	std::vector<std::pair<size_t, bool>> ordered = chain_segments_greedy<Point, decltype(segment_end_point)>(segment_end_point, instances.size(), nullptr);
     std::vector<const PrintInstance*> out;
@@ -2989,33 +2989,41 @@ void GCodeViewer::load_shells(const Print& print)
 
     // adds objects' volumes 
     for (const PrintObject* obj : print.objects()) {
-        const ModelObject* model_obj = obj->model_object();
-        int object_id = -1;
-        const ModelObjectPtrs model_objects = wxGetApp().plater()->model().objects;
-        for (int i = 0; i < static_cast<int>(model_objects.size()); ++i) {
-            if (model_obj->id() == model_objects[i]->id()) {
-                object_id = i;
-                break;
+        // The instances of ModelObjects equal to each other are printed by a single PrintObject, load the shells of all of them.
+        std::vector<const ModelObject*> model_objs;
+        for (const PrintInstance &print_instance : obj->instances())
+            if (const ModelObject *model_obj = print_instance.model_instance->get_object();
+                std::find(model_objs.begin(), model_objs.end(), model_obj) == model_objs.end())
+                model_objs.emplace_back(model_obj);
+
+        for (const ModelObject *model_obj : model_objs) {
+            int object_id = -1;
+            const ModelObjectPtrs model_objects = wxGetApp().plater()->model().objects;
+            for (int i = 0; i < static_cast<int>(model_objects.size()); ++i) {
+                if (model_obj->id() == model_objects[i]->id()) {
+                    object_id = i;
+                    break;
+                }
             }
-        }
-        if (object_id == -1)
-            continue;
+            if (object_id == -1)
+                continue;
 
-        std::vector<int> instance_ids(model_obj->instances.size());
-        for (int i = 0; i < (int)model_obj->instances.size(); ++i) {
-            instance_ids[i] = i;
-        }
+            std::vector<int> instance_ids(model_obj->instances.size());
+            for (int i = 0; i < (int)model_obj->instances.size(); ++i) {
+                instance_ids[i] = i;
+            }
 
-        size_t current_volumes_count = m_shells.volumes.volumes.size();
-        m_shells.volumes.load_object(model_obj, object_id, instance_ids);
+            size_t current_volumes_count = m_shells.volumes.volumes.size();
+            m_shells.volumes.load_object(model_obj, object_id, instance_ids);
 
-        // adjust shells' z if raft is present
-        const SlicingParameters& slicing_parameters = obj->slicing_parameters();
-        if (slicing_parameters.object_print_z_min != 0.0) {
-            const Vec3d z_offset = slicing_parameters.object_print_z_min * Vec3d::UnitZ();
-            for (size_t i = current_volumes_count; i < m_shells.volumes.volumes.size(); ++i) {
-                GLVolume* v = m_shells.volumes.volumes[i].get();
-                v->set_volume_offset(v->get_volume_offset() + z_offset);
+            // adjust shells' z if raft is present
+            const SlicingParameters& slicing_parameters = obj->slicing_parameters();
+            if (slicing_parameters.object_print_z_min != 0.0) {
+                const Vec3d z_offset = slicing_parameters.object_print_z_min * Vec3d::UnitZ();
+                for (size_t i = current_volumes_count; i < m_shells.volumes.volumes.size(); ++i) {
+                    GLVolume* v = m_shells.volumes.volumes[i].get();
+                    v->set_volume_offset(v->get_volume_offset() + z_offset);
+                }
             }
         }
     }
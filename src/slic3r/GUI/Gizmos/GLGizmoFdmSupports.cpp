@@ -414,11 +414,12 @@ void GLGizmoFdmSupports::apply_data_from_backend()
 
     // find the respective PrintObject, we need a pointer to it
     for (const PrintObject *po : m_parent.fff_print()->objects()) {
-        if (po->model_object()->id() == mo->id()) {
+        // The PrintObject may be shared with an equal ModelObject, whose volumes have the same meshes and transformations.
+        if (po->prints_model_object(mo->id())) {
             std::unordered_map<size_t, TriangleSelectorWrapper> selectors;
             SupportSpotsGenerator::SupportPoints support_points = po->shared_regions()->generated_support_points->support_points;
             auto                                 obj_transform  = po->shared_regions()->generated_support_points->object_transform;
-            for (ModelVolume *model_volume : po->model_object()->volumes) {
+            for (ModelVolume *model_volume : mo->volumes) {
                 if (model_volume->is_model_part()) {
                     Transform3d mesh_transformation = obj_transform * model_volume->get_matrix();
                     Transform3d inv_transform       = mesh_transformation.inverse();
@@ -505,7 +506,7 @@ bool GLGizmoFdmSupports::has_backend_supports()
     // find PrintObject with this ID
     bool done = false;
     for (const PrintObject *po : m_parent.fff_print()->objects()) {
-        if (po->model_object()->id() == mo->id())
+        if (po->prints_model_object(mo->id()))
             done = done || po->is_step_done(posSupportSpotsSearch);
     }
 
@@ -463,6 +463,58 @@ TEST_CASE("NFP should be empty if item cannot fit into bed", "[arrange2]") {
     }
 }
 
+TEST_CASE("NFP with copies of the same fixed item reuses the part nfps", "[arrange2]") {
+    using namespace Slic3r;
+
+    arr2::InfiniteBed bed;
+    auto parts = prusa_parts_ex();
+    REQUIRE(parts.size() > 1);
+
+    arr2::ArrangeItem orbiter = parts[1];
+    arr2::set_rotation(orbiter, PI / 3.);
+
+    std::vector<arr2::ArrangeItem> copies(3, parts.front());
+    for (size_t i = 0; i < copies.size(); ++i) {
+        arr2::set_rotation(copies[i], PI / 4.);
+        arr2::set_translation(copies[i], Vec2crd{scaled(200. * i), scaled(50. * i)});
+        REQUIRE(copies[i].shape().shape_hash() == parts.front().shape().shape_hash());
+    }
+
+    // All the copies at once: the nfps of the parts are computed for the first copy only.
+    std::vector<std::reference_wrapper<const arr2::ArrangeItem>> fixed(copies.begin(), copies.end());
+    ExPolygons nfp = arr2::calculate_nfp(orbiter, arr2::default_context(fixed), bed);
+
+    // One copy at a time, nothing can be reused.
+    ExPolygons nfp_ref;
+    for (const arr2::ArrangeItem &copy : copies) {
+        std::array<std::reference_wrapper<const arr2::ArrangeItem>, 1> one_fixed = {{copy}};
+        append(nfp_ref, arr2::calculate_nfp(orbiter, arr2::default_context(one_fixed), bed));
+    }
+    nfp_ref = union_ex(nfp_ref);
+
+    REQUIRE(!nfp.empty());
+    REQUIRE(nfp.size() == nfp_ref.size());
+    REQUIRE(area(nfp) == Approx(area(nfp_ref)));
+    REQUIRE(area(diff_ex(nfp, nfp_ref)) == Approx(0.).margin(scaled(1.)));
+}
+
+TEST_CASE("NFP cache keys compare the shapes on a hash hit", "[arrange2]") {
+    using namespace Slic3r;
+
+    Polygons square   = {Polygon{{0, 0}, {10, 0}, {10, 10}, {0, 10}}};
+    Polygons moved    = {Polygon{{5, 5}, {15, 5}, {15, 15}, {5, 15}}};
+    Polygons triangle = {Polygon{{0, 0}, {10, 0}, {0, 10}}};
+    REQUIRE(arr2::translation_invariant_equal(square, moved));
+    REQUIRE(!arr2::translation_invariant_equal(square, triangle));
+
+    // Same hash for different shapes, as with a hash collision.
+    const size_t hash = arr2::translation_invariant_hash(square);
+    arr2::NFPCache cache;
+    cache.emplace({&square, hash, 0., 0, 0}, Polygon{{0, 0}, {1, 0}, {1, 1}});
+    REQUIRE(cache.find({&moved, hash, 0., 0, 0}) != cache.end());
+    REQUIRE(cache.find({&triangle, hash, 0., 0, 0}) == cache.end());
+}
+
 #include <boost/filesystem/path.hpp>
 #include <boost/filesystem.hpp>
 
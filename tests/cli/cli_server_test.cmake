@@ -0,0 +1,65 @@
+# Client of the --server mode of the command line slicer, sending two jobs over one session.
+# The first job overrides the layer height. The second one doesn't, so it has to be sliced with the config
+# loaded at the server startup and give the same G-code as a plain command line run.
+
+foreach (var SLICER TEST_DATA_DIR WORK_DIR)
+    if (NOT DEFINED ${var})
+        message(FATAL_ERROR "${var} is not set")
+    endif ()
+endforeach ()
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+file(TO_CMAKE_PATH "${TEST_DATA_DIR}/20mm_cube.obj" model)
+file(WRITE ${WORK_DIR}/server.ini "layer_height = 0.3\n")
+
+execute_process(COMMAND ${SLICER} --load server.ini --export-gcode --output plain.gcode ${model}
+    WORKING_DIRECTORY ${WORK_DIR}
+    RESULT_VARIABLE result
+    OUTPUT_QUIET)
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "Plain command line run failed: ${result}")
+endif ()
+
+file(WRITE ${WORK_DIR}/jobs.txt
+    "{\"id\": \"1\", \"input\": [\"${model}\"], \"config\": {\"layer_height\": \"0.2\"}, \"output\": \"job1.gcode\"}\n"
+    "{\"id\": \"2\", \"input\": [\"${model}\"], \"output\": \"job2.gcode\"}\n"
+    "{\"command\": \"quit\"}\n")
+execute_process(COMMAND ${SLICER} --load server.ini --server
+    WORKING_DIRECTORY ${WORK_DIR}
+    INPUT_FILE ${WORK_DIR}/jobs.txt
+    OUTPUT_VARIABLE replies
+    RESULT_VARIABLE result)
+if (NOT result EQUAL 0)
+    message(FATAL_ERROR "Server failed: ${result}\n${replies}")
+endif ()
+# One reply per job and one for the quit command.
+string(REGEX MATCHALL "\"status\":\"ok\"" ok_replies "${replies}")
+list(LENGTH ok_replies num_ok_replies)
+if (NOT num_ok_replies EQUAL 3)
+    message(FATAL_ERROR "Unexpected server replies:\n${replies}")
+endif ()
+
+# G-code without the header line holding the slicer version and the time of the export.
+function(read_gcode path out_var)
+    if (NOT EXISTS ${path})
+        message(FATAL_ERROR "${path} was not exported")
+    endif ()
+    file(READ ${path} gcode)
+    string(REGEX REPLACE "; generated by [^\n]*\n" "" gcode "${gcode}")
+    set(${out_var} "${gcode}" PARENT_SCOPE)
+endfunction()
+
+read_gcode(${WORK_DIR}/plain.gcode plain)
+read_gcode(${WORK_DIR}/job1.gcode job1)
+read_gcode(${WORK_DIR}/job2.gcode job2)
+
+if (NOT job1 MATCHES "\n; layer_height = 0.2\n")
+    message(FATAL_ERROR "The first job ignored its layer height")
+endif ()
+if (NOT job2 MATCHES "\n; layer_height = 0.3\n")
+    message(FATAL_ERROR "The second job didn't use the config loaded by the server")
+endif ()
+if (NOT job2 STREQUAL plain)
+    message(FATAL_ERROR "The second job differs from the plain command line run")
+endif ()
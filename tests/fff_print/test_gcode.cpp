@@ -9,6 +9,7 @@
 #include <fstream>
 
 #include "libslic3r/GCode.hpp"
+#include "libslic3r/GCode/ConflictChecker.hpp"
 #include "libslic3r/Geometry/ConvexHull.hpp"
 #include "libslic3r/ModelArrange.hpp"
 #include "test_data.hpp"
@@ -323,3 +324,36 @@ TEST_CASE("M201 for acceleation reset", "[GCode]") {
     INFO("M204 is not generated for repetier firmware");
     CHECK(!has_m204);
 }
+
+TEST_CASE("Conflict checker tests lines of different instances only", "[GCode]") {
+    auto line = [](double x1, double y1, double x2, double y2, int obj_id, int inst_id) {
+        return LineWithID(Line(Point::new_scale(x1, y1), Point::new_scale(x2, y2)), obj_id, inst_id, ExtrusionRole::Perimeter);
+    };
+    // Dense lines of one instance crossing each other, spread over many grid cells.
+    LineWithIDs lines;
+    for (int i = 0; i < 20; ++i) {
+        lines.emplace_back(line(0., i, 20., i + 0.5, 0, 0));
+        lines.emplace_back(line(i, 0., i + 0.5, 20., 0, 0));
+    }
+    CHECK(! ConflictChecker::find_inter_of_lines(lines).has_value());
+
+    SECTION("Parallel line of other object in the same cells") {
+        lines.emplace_back(line(0., 25., 20., 25., 1, 0));
+        lines.emplace_back(line(0., 25.5, 20., 25.5, 0, 0));
+        CHECK(! ConflictChecker::find_inter_of_lines(lines).has_value());
+    }
+    SECTION("Line of other object crossing") {
+        lines.emplace_back(line(10.2, -5., 10.2, 30., 1, 0));
+        ConflictComputeOpt res = ConflictChecker::find_inter_of_lines(lines);
+        REQUIRE(res.has_value());
+        CHECK(std::min(res->_obj1, res->_obj2) == 0);
+        CHECK(std::max(res->_obj1, res->_obj2) == 1);
+    }
+    SECTION("Line of other instance of the same object crossing") {
+        lines.emplace_back(line(-5., 10.2, 30., 10.2, 0, 1));
+        ConflictComputeOpt res = ConflictChecker::find_inter_of_lines(lines);
+        REQUIRE(res.has_value());
+        CHECK(res->_obj1 == 0);
+        CHECK(res->_obj2 == 0);
+    }
+}
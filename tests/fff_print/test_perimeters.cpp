@@ -627,3 +627,27 @@ SCENARIO("Seam alignment", "[Perimeters]")
         test(Slic3r::Test::TestMesh::small_dorito);
     }
 }
+
+TEST_CASE("Perimeter cache", "[Perimeters]")
+{
+    using Cache = PerimeterGenerator::Cache;
+    Cache      cache;
+    Surface    surface(stPosInternal | stDensSparse, ExPolygon{ Point::new_scale(0, 0), Point::new_scale(20, 0), Point::new_scale(20, 20), Point::new_scale(0, 20) });
+    ExPolygons lower_slices{ surface.expolygon };
+    auto query_for = [&lower_slices](const Surface &surface, const ExPolygons *upper_slices) {
+        return Cache::Query{ nullptr, 0.2, 0, &surface, &lower_slices, upper_slices,
+                             Cache::hash(nullptr, 0.2, 0, surface, Cache::hash(&lower_slices), Cache::hash(upper_slices)) };
+    };
+    Cache::Result result;
+    result.fill_expolygons = offset_ex(surface.expolygon, -scale_(1.));
+    cache.insert(query_for(surface, nullptr), result);
+
+    Cache::Result found;
+    REQUIRE(cache.find(query_for(surface, nullptr), found));
+    CHECK(found.fill_expolygons == result.fill_expolygons);
+    // A layer with an upper layer isn't a top layer.
+    CHECK(! cache.find(query_for(surface, &lower_slices), found));
+    Surface other = surface;
+    other.extra_perimeters = 1;
+    CHECK(! cache.find(query_for(other, nullptr), found));
+}
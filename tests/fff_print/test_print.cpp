@@ -3,6 +3,7 @@
 #include "libslic3r/libslic3r.h"
 #include "libslic3r/Print.hpp"
 #include "libslic3r/Layer.hpp"
+#include "libslic3r/ShortestPath.hpp"
 
 #include "test_data.hpp"
 
@@ -197,3 +198,236 @@ SCENARIO("Ported from Perl", "[Print]") {
         }
     }
 }
+
+SCENARIO("Print: Applying a G-code only option keeps the sliced objects", "[Print]") {
+    GIVEN("20mm cube, processed") {
+        DynamicPrintConfig config = DynamicPrintConfig::full_print_config();
+        Slic3r::Print print;
+        Slic3r::Model model;
+        Slic3r::Test::init_print({TestMesh::cube_20x20x20}, print, model, config);
+        print.process();
+        REQUIRE(print.objects().size() == 1);
+        const PrintObject *object = print.objects().front();
+        const PrintRegion *region = &print.get_print_region(0);
+        WHEN("max_fan_speed is changed") {
+            // Mark the region: verifying the regions against the model would reset it to the model's value.
+            PrintRegionConfig marked_config = region->config();
+            marked_config.perimeters.value = region->config().perimeters.value + 3;
+            const_cast<PrintRegion*>(region)->set_config(marked_config);
+            DynamicPrintConfig new_config = print.full_print_config();
+            new_config.set_deserialize_strict("max_fan_speed", "50");
+            Print::ApplyStatus status = print.apply(model, new_config);
+            THEN("Slicing results and regions are reused without verifying the regions") {
+                REQUIRE(status != Print::APPLY_STATUS_UNCHANGED);
+                REQUIRE(print.objects().size() == 1);
+                REQUIRE(print.objects().front() == object);
+                REQUIRE(object->is_step_done(posSlice));
+                REQUIRE(object->is_step_done(posPerimeters));
+                REQUIRE(object->is_step_done(posInfill));
+                REQUIRE(&print.get_print_region(0) == region);
+                REQUIRE(print.get_print_region(0).config().perimeters.value == marked_config.perimeters.value);
+            }
+        }
+        WHEN("perimeters is changed") {
+            DynamicPrintConfig new_config = print.full_print_config();
+            new_config.set_deserialize_strict("perimeters", "5");
+            print.apply(model, new_config);
+            THEN("Perimeters are invalidated") {
+                REQUIRE(! print.objects().front()->is_step_done(posPerimeters));
+                REQUIRE(print.get_print_region(0).config().perimeters.value == 5);
+            }
+        }
+    }
+}
+
+SCENARIO("Print: Equal objects share a PrintObject", "[Print]") {
+    GIVEN("Two separately loaded 20mm cubes") {
+        Slic3r::Print print;
+        Slic3r::Model model;
+        WHEN("Printed together") {
+            Slic3r::Test::init_print({TestMesh::cube_20x20x20, TestMesh::cube_20x20x20}, print, model, DynamicPrintConfig::full_print_config());
+            THEN("They are sliced as one PrintObject with two instances") {
+                REQUIRE(model.objects.size() == 2);
+                REQUIRE(print.objects().size() == 1);
+                REQUIRE(print.objects().front()->instances().size() == 2);
+                REQUIRE(print.get_print_object_by_model_object_id(model.objects.back()->id()) == print.objects().front());
+                REQUIRE(print.objects().front()->model_object()->id() == model.objects.front()->id());
+            }
+            THEN("A task limited to the second object finds the shared PrintObject") {
+                REQUIRE(print.objects().front()->prints_model_object(model.objects.back()->id()));
+                PrintBase::TaskParams task;
+                task.single_model_object        = model.objects.back()->id();
+                task.single_model_instance_only = true;
+                task.to_object_step             = posSlice;
+                print.set_task(task);
+                print.finalize();
+            }
+            THEN("Applying the same model again keeps the shared PrintObject") {
+                const PrintObject *print_object = print.objects().front();
+                print.apply(model, print.full_print_config());
+                REQUIRE(print.objects().size() == 1);
+                REQUIRE(print.objects().front() == print_object);
+            }
+            THEN("Changing the config of one of them splits the PrintObject") {
+                model.objects.back()->config.set("perimeters", 5);
+                print.apply(model, print.full_print_config());
+                REQUIRE(print.objects().size() == 2);
+                REQUIRE(print.objects().front()->instances().size() == 1);
+                REQUIRE(print.objects().back()->instances().size() == 1);
+            }
+            THEN("An option overridden by the second one only splits the PrintObject and is kept") {
+                model.objects.back()->config.set("support_material", true);
+                print.apply(model, print.full_print_config());
+                REQUIRE(print.objects().size() == 2);
+                REQUIRE(! print.objects().front()->config().support_material.value);
+                REQUIRE(print.objects().back()->config().support_material.value);
+            }
+            THEN("The shared PrintObject is named after both objects") {
+                model.objects.front()->name = "first";
+                model.objects.back()->name  = "second";
+                print.apply(model, print.full_print_config());
+                REQUIRE(print.objects().front()->model_objects_names() == "first, second");
+            }
+        }
+        WHEN("Printed sequentially") {
+            Slic3r::Test::init_print({TestMesh::cube_20x20x20, TestMesh::cube_20x20x20}, print, model, { { "complete_objects", true } });
+            THEN("Each object has its own PrintObject") {
+                REQUIRE(print.objects().size() == 2);
+            }
+        }
+    }
+}
+
+SCENARIO("Print: Instances of a shared PrintObject keep the order of their objects", "[Print]") {
+    GIVEN("A cube, a pyramid and a cube") {
+        Slic3r::Print print;
+        Slic3r::Model model;
+        Slic3r::Test::init_print({TestMesh::cube_20x20x20, TestMesh::pyramid, TestMesh::cube_20x20x20}, print, model, DynamicPrintConfig::full_print_config());
+        auto chained_objects = [&model, &print]() {
+            std::vector<size_t> out;
+            for (const PrintInstance *instance : chain_print_object_instances(print))
+                out.emplace_back(std::find(model.objects.begin(), model.objects.end(), instance->model_instance->get_object()) - model.objects.begin());
+            return out;
+        };
+        REQUIRE(print.objects().size() == 2);
+        const std::vector<size_t> shared = chained_objects();
+        WHEN("The second cube gets its own PrintObject") {
+            // Overriding an option with its default value keeps the G-code, but the objects are no longer equal.
+            model.objects.back()->config.set("perimeters", print.full_print_config().opt_int("perimeters"));
+            print.apply(model, print.full_print_config());
+            REQUIRE(print.objects().size() == 3);
+            THEN("The instances are chained in the same order") {
+                REQUIRE(chained_objects() == shared);
+            }
+        }
+    }
+}
+
+SCENARIO("Print: Changing the config of a volume's material updates its region", "[Print]") {
+    GIVEN("20mm cube with a material, processed") {
+        DynamicPrintConfig config = DynamicPrintConfig::full_print_config();
+        config.set_deserialize_strict("perimeters", "2");
+        Slic3r::Model model;
+        ModelObject *model_object = model.add_object();
+        model_object->add_volume(Slic3r::Test::mesh(TestMesh::cube_20x20x20));
+        model_object->add_instance();
+        model_object->volumes.front()->set_material_id("material");
+        model.center_instances_around_point({100, 100});
+        model_object->ensure_on_bed();
+        Slic3r::Print print;
+        print.apply(model, config);
+        print.process();
+        REQUIRE(print.get_print_region(0).config().perimeters.value == 2);
+        WHEN("perimeters is changed in the material config") {
+            model.get_material("material")->config.set("perimeters", 5);
+            print.apply(model, config);
+            THEN("Perimeters are invalidated and the region uses the material config") {
+                REQUIRE(! print.objects().front()->is_step_done(posPerimeters));
+                REQUIRE(print.get_print_region(0).config().perimeters.value == 5);
+            }
+        }
+    }
+}
+
+static Points collect_fill_points(const Print &print)
+{
+    Points points;
+    for (const PrintObject *object : print.objects())
+        for (const Layer *layer : object->layers())
+            for (const LayerRegion *layerm : layer->regions()) {
+                layerm->fills().collect_points(points);
+                layerm->ironings().collect_points(points);
+            }
+    return points;
+}
+
+static bool all_layers_compressed(const Print &print)
+{
+    for (const PrintObject *object : print.objects())
+        for (const Layer *layer : object->layers()) {
+            if (! layer->slices_compressed())
+                return false;
+            for (const LayerRegion *layerm : layer->regions())
+                if (! layerm->fill_expolygons_compressed() || ! layerm->slices_compressed())
+                    return false;
+        }
+    return true;
+}
+
+// The G-code without its "generated by" line, which contains the time of the export.
+static std::string gcode_without_header(Print &print)
+{
+    std::string gcode = Slic3r::Test::gcode(print);
+    if (size_t pos = gcode.find("; generated by"); pos != std::string::npos)
+        gcode.erase(pos, gcode.find('\n', pos) - pos);
+    return gcode;
+}
+
+SCENARIO("Print: Compressing the finished layers keeps the infill", "[Print]") {
+    GIVEN("20mm cube with ironing, exported with and without compression of the finished layers") {
+        DynamicPrintConfig config = DynamicPrintConfig::full_print_config();
+        config.set_deserialize_strict({ { "fill_density", "20%" }, { "ironing", "1" } });
+        Slic3r::Print print_ref, print;
+        Slic3r::Model model_ref, model;
+        print.set_compress_finished_layers(true);
+        Slic3r::Test::init_print({TestMesh::cube_20x20x20}, print_ref, model_ref, config);
+        Slic3r::Test::init_print({TestMesh::cube_20x20x20}, print, model, config);
+        std::string gcode_ref = gcode_without_header(print_ref);
+        std::string gcode     = gcode_without_header(print);
+        THEN("The layers are compressed and the G-code is the same") {
+            REQUIRE(! print.objects().front()->layers().empty());
+            REQUIRE(all_layers_compressed(print));
+            REQUIRE(! print_ref.objects().front()->layers().front()->slices_compressed());
+            REQUIRE(gcode == gcode_ref);
+            REQUIRE_THROWS(print.objects().front()->layers().front()->lslices());
+        }
+        WHEN("The G-code is exported again") {
+            THEN("It is the same") {
+                REQUIRE(gcode_without_header(print) == gcode_ref);
+                REQUIRE(all_layers_compressed(print));
+            }
+        }
+        WHEN("fill_density is changed") {
+            config.set_deserialize_strict("fill_density", "40%");
+            print_ref.apply(model_ref, config);
+            print.apply(model, config);
+            REQUIRE(! print.objects().front()->is_step_done(posInfill));
+            THEN("The infill regenerated from the decompressed layers is the same") {
+                REQUIRE(gcode_without_header(print) == gcode_without_header(print_ref));
+                REQUIRE(all_layers_compressed(print));
+                REQUIRE(collect_fill_points(print) == collect_fill_points(print_ref));
+            }
+        }
+        WHEN("perimeters is changed") {
+            config.set_deserialize_strict("perimeters", "4");
+            print_ref.apply(model_ref, config);
+            print.apply(model, config);
+            REQUIRE(! print.objects().front()->is_step_done(posPerimeters));
+            THEN("The infill uses the regenerated fill expolygons") {
+                REQUIRE(gcode_without_header(print) == gcode_without_header(print_ref));
+                REQUIRE(all_layers_compressed(print));
+                REQUIRE(collect_fill_points(print) == collect_fill_points(print_ref));
+            }
+        }
+    }
+}
@@ -6,6 +6,8 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <tbb/task_arena.h>
+
 #include "test_data.hpp" // get access to init_print, etc
 
 using namespace Slic3r::Test;
@@ -266,3 +268,52 @@ SCENARIO("Original Slic3r Skirt/Brim tests", "[SkirtBrim]") {
         }
     }
 }
+
+// Process a plate of small cubes with skirt and brim.
+static void process_many_instances(unsigned int nb_instances, Print &print, Model &model)
+{
+    DynamicPrintConfig config = Slic3r::DynamicPrintConfig::full_print_config();
+    config.set_deserialize_strict({
+        { "skirts",             1 },
+        { "skirt_distance",     2 },
+        { "brim_width",         3 },
+        { "first_layer_height", 0.2 },
+        { "layer_height",       0.2 },
+        { "perimeters",         1 },
+        { "fill_density",       "0%" }
+    });
+    Slic3r::Test::init_print({ Slic3r::Test::mesh(TestMesh::cube_20x20x20, Vec3d::Zero(), 0.2) }, print, model, config, false, nb_instances);
+    print.process();
+}
+
+TEST_CASE("Brim and skirt on a plate with many instances", "[SkirtBrim]") {
+    Print print;
+    Model model;
+    process_many_instances(20, print, model);
+    THEN("the brim is generated around all the instances") {
+        REQUIRE(!print.brim().empty());
+        // at least one brim loop per instance (the instances can share the outer loops)
+        REQUIRE(print.brim().items_count() >= 20);
+    }
+    THEN("a single skirt surrounds the plate") {
+        REQUIRE(print.skirt().entities().size() == 1);
+    }
+}
+
+TEST_CASE("Brim and skirt on many instances are the same with a single thread", "[SkirtBrim]") {
+    Print print;
+    Model model;
+    process_many_instances(20, print, model);
+    Print print_serial;
+    Model model_serial;
+    tbb::task_arena single_thread(1);
+    single_thread.execute([&print_serial, &model_serial]() { process_many_instances(20, print_serial, model_serial); });
+    Points brim_points, brim_points_serial, skirt_points, skirt_points_serial;
+    print.brim().collect_points(brim_points);
+    print_serial.brim().collect_points(brim_points_serial);
+    print.skirt().collect_points(skirt_points);
+    print_serial.skirt().collect_points(skirt_points_serial);
+    REQUIRE(!brim_points.empty());
+    REQUIRE(brim_points == brim_points_serial);
+    REQUIRE(skirt_points == skirt_points_serial);
+}
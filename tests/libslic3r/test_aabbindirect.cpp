@@ -1,4 +1,6 @@
 #include <algorithm>
+#include <chrono>
+#include <iostream>
 #include <catch2/catch.hpp>
 #include <test_utils.hpp>
 
@@ -61,6 +63,91 @@ TEST_CASE("Building a tree over a box, ray caster and closest query", "[AABBIndi
     REQUIRE(closest_point.z() == Approx(1.));
 }
 
+// Rays shot from points around the mesh into neighbor directions, as the seam placer does.
+static std::vector<std::pair<Vec3d, Vec3d>> make_coherent_rays(const indexed_triangle_set &its, size_t num_origins, size_t rays_per_origin)
+{
+    BoundingBoxf3 bbox = bounding_box(its);
+    std::vector<std::pair<Vec3d, Vec3d>> rays;
+    for (size_t i = 0; i < num_origins; ++ i) {
+        double a      = 2. * PI * double(i) / double(num_origins);
+        Vec3d  origin = bbox.center() + bbox.size().norm() * Vec3d(cos(a), sin(a), 0.1 * double(i % 7) - 0.3);
+        Vec3d  to_center = (bbox.center() - origin).normalized();
+        Vec3d  side      = to_center.cross(Vec3d::UnitZ()).normalized();
+        for (size_t j = 0; j < rays_per_origin; ++ j) {
+            double b = 0.6 * (double(j) / double(rays_per_origin) - 0.5);
+            rays.emplace_back(origin, (to_center + b * side + 0.3 * b * Vec3d::UnitZ()).normalized());
+        }
+    }
+    return rays;
+}
+
+TEST_CASE("Ray packets hit the same triangles as single rays", "[AABBIndirect]")
+{
+    TriangleMesh tmesh = make_sphere(10., 2. * PI / 60.);
+    auto tree = AABBTreeIndirect::build_aabb_tree_over_indexed_triangle_set(tmesh.its.vertices, tmesh.its.indices);
+
+    // 13 rays per origin to have partially filled packets as well.
+    std::vector<std::pair<Vec3d, Vec3d>> rays = make_coherent_rays(tmesh.its, 20, 13);
+
+    AABBTreeIndirect::RayPacket<Vec3d> packet;
+    std::array<igl::Hit, AABBTreeIndirect::RayPacket<Vec3d>::Size> packet_hits;
+    size_t num_hits = 0;
+    for (size_t first = 0; first < rays.size(); first += packet.Size) {
+        packet.clear();
+        for (size_t i = first; i < std::min(rays.size(), first + packet.Size); ++ i)
+            packet.push_back(rays[i].first, rays[i].second);
+        uint32_t hit_mask = AABBTreeIndirect::intersect_ray_packet_first_hit(
+            tmesh.its.vertices, tmesh.its.indices, tree, packet, packet_hits);
+        for (size_t i = 0; i < packet.size(); ++ i) {
+            igl::Hit hit;
+            bool intersected = AABBTreeIndirect::intersect_ray_first_hit(
+                tmesh.its.vertices, tmesh.its.indices, tree, packet.origin[i], packet.dir[i], hit);
+            REQUIRE(intersected == bool(hit_mask & (uint32_t(1) << i)));
+            if (intersected) {
+                ++ num_hits;
+                CHECK(packet_hits[i].id == hit.id);
+                CHECK(packet_hits[i].t == hit.t);
+            }
+        }
+    }
+    CHECK(num_hits > 0);
+    CHECK(num_hits < rays.size());
+}
+
+TEST_CASE("Ray packets vs single rays time benchmark", "[AABBIndirect][.benchmark]")
+{
+    TriangleMesh tmesh = make_sphere(10., 2. * PI / 400.);
+    auto tree = AABBTreeIndirect::build_aabb_tree_over_indexed_triangle_set(tmesh.its.vertices, tmesh.its.indices);
+    std::vector<std::pair<Vec3d, Vec3d>> rays = make_coherent_rays(tmesh.its, 20000, 32);
+
+    using namespace std::chrono;
+    size_t single_hits = 0;
+    high_resolution_clock::time_point t1 = high_resolution_clock::now();
+    for (const auto &ray : rays) {
+        igl::Hit hit;
+        single_hits += AABBTreeIndirect::intersect_ray_first_hit(tmesh.its.vertices, tmesh.its.indices, tree, ray.first, ray.second, hit);
+    }
+    high_resolution_clock::time_point t2 = high_resolution_clock::now();
+    std::cout << "Single rays took " << duration_cast<duration<double>>(t2 - t1).count() << " seconds." << std::endl;
+
+    AABBTreeIndirect::RayPacket<Vec3d> packet;
+    std::array<igl::Hit, AABBTreeIndirect::RayPacket<Vec3d>::Size> packet_hits;
+    size_t packet_hits_count = 0;
+    t1 = high_resolution_clock::now();
+    for (size_t first = 0; first < rays.size(); first += packet.Size) {
+        packet.clear();
+        for (size_t i = first; i < std::min(rays.size(), first + packet.Size); ++ i)
+            packet.push_back(rays[i].first, rays[i].second);
+        uint32_t hit_mask = AABBTreeIndirect::intersect_ray_packet_first_hit(tmesh.its.vertices, tmesh.its.indices, tree, packet, packet_hits);
+        for (; hit_mask; hit_mask &= hit_mask - 1)
+            ++ packet_hits_count;
+    }
+    t2 = high_resolution_clock::now();
+    std::cout << "Ray packets of " << packet.Size << " took " << duration_cast<duration<double>>(t2 - t1).count() << " seconds." << std::endl;
+
+    REQUIRE(single_hits == packet_hits_count);
+}
+
 TEST_CASE("Creating a several 2d lines, testing closest point query", "[AABBIndirect]")
 {
     std::vector<Linef> lines { };
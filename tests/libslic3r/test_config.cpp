@@ -4,8 +4,13 @@
 #include "libslic3r/PrintConfig.hpp"
 #include "libslic3r/LocalesUtils.hpp"#include "libslic3r/Model.hpp"
 #include "libslic3r/Print.hpp"
+#include "libslic3r/Thread.hpp"
 #include <test_data.hpp>
 
+#include <chrono>
+#include <iostream>
+#include <optional>
+
 #include <cereal/types/polymorphic.hpp>
 #include <cereal/types/string.hpp> 
 #include <cereal/types/vector.hpp> 
@@ -99,6 +104,17 @@ TEST_CASE("Get keys", "[Config]"){
     CHECK(!config.keys().empty());
 }
 
+TEST_CASE("Option definition lookup", "[Config]") {
+    const ConfigOptionDef *def = print_config_def.get("perimeters");
+    REQUIRE(def != nullptr);
+    CHECK(def == &print_config_def.options.at("perimeters"));
+    CHECK(print_config_def.get("no_such_option") == nullptr);
+    CHECK(print_config_def.has("layer_height"));
+    // A copy of the definition shall return its own option definitions.
+    ConfigDef copy = print_config_def;
+    CHECK(copy.get("perimeters") == &copy.options.at("perimeters"));
+}
+
 TEST_CASE("Set not already set option", "[Config]") {
     DynamicPrintConfig config;
     config.set_deserialize_strict("filament_diameter", "3");
@@ -499,3 +515,41 @@ SCENARIO("DynamicPrintConfig serialization", "[Config]") {
         }
     }
 }
+
+TEST_CASE("Static configs get their defaults on first use", "[Config]") {
+    // Constructed from several threads at once: the cache is initialized by only one of them.
+    std::vector<std::optional<SLAFullPrintConfig>> configs(4);
+    Slic3r::parallel_for(size_t(0), configs.size(), [&configs](size_t idx) { configs[idx].emplace(); });
+    for (const std::optional<SLAFullPrintConfig> &config : configs) {
+        REQUIRE(config.has_value());
+        REQUIRE(config->diff(SLAFullPrintConfig::defaults()).empty());
+        REQUIRE(config->layer_height.value == print_config_def.get("layer_height")->default_value->get_float());
+    }
+}
+
+TEST_CASE("Static config defaults are the defaults of the option definitions", "[Config]") {
+    // A freshly constructed PrintConfigDef defines the same options as the global one the caches are built from.
+    PrintConfigDef config_def;
+    REQUIRE(config_def.options.size() == print_config_def.options.size());
+    const FullPrintConfig &defaults = FullPrintConfig::defaults();
+    REQUIRE(! defaults.keys().empty());
+    for (const std::string &key : defaults.keys()) {
+        const ConfigOptionDef *def = config_def.get(key);
+        REQUIRE(def != nullptr);
+        if (def->default_value)
+            REQUIRE(*defaults.option(key) == *def->default_value);
+    }
+    REQUIRE(FullPrintConfig().diff(defaults).empty());
+}
+
+TEST_CASE("PrintConfigDef construction time", "[Config][.benchmark]") {
+    auto t0 = std::chrono::steady_clock::now();
+    PrintConfigDef config_def;
+    auto t1 = std::chrono::steady_clock::now();
+    FullPrintConfig full_print_config;
+    auto t2 = std::chrono::steady_clock::now();
+    std::cout << "PrintConfigDef: " << config_def.options.size() << " options in "
+              << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms, FullPrintConfig: "
+              << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms" << std::endl;
+    REQUIRE(config_def.options.size() == print_config_def.options.size());
+}
@@ -160,4 +160,68 @@ TEST_CASE("Serialization of expolygons to string", "[ExPolygon, Cereal, serializ
     }
 
     CHECK(expolys == expolys_loaded);
-}
\ No newline at end of file
+}
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include "libslic3r/CompressedExPolygons.hpp"
+
+// Rings of count x points, the contour points are moved randomly by up to jitter to mimic sliced meshes.
+static ExPolygons make_ring_expolygons(int count, int points, coord_t jitter = 0)
+{
+    std::mt19937 rng(count);
+    ExPolygons out;
+    for (int i = 0; i < count; ++ i) {
+        ExPolygon expoly;
+        Point     center(scaled(20. * i), scaled(5. * (i % 7)));
+        for (int j = 0; j < points; ++ j) {
+            double a = 2. * M_PI * j / points;
+            expoly.contour.points.emplace_back(center + Point(scaled(10. * cos(a)), scaled(10. * sin(a))));
+            if (jitter > 0)
+                expoly.contour.points.back() += Point(coord_t(rng() % jitter), coord_t(rng() % jitter));
+            expoly.holes.resize(1);
+            expoly.holes.front().points.emplace_back(center + Point(scaled(4. * cos(-a)), scaled(4. * sin(-a))));
+        }
+        out.emplace_back(std::move(expoly));
+    }
+    return out;
+}
+
+TEST_CASE("CompressedExPolygons round trip", "[ExPolygon]") {
+    SECTION("empty") {
+        CompressedExPolygons compressed(ExPolygons{});
+        CHECK(compressed.empty());
+        CHECK(compressed.decompress().empty());
+    }
+    SECTION("squares with holes and negative coordinates") {
+        ExPolygons expolys{ ExPolygon{ { { -10, -10 }, { 10, -10 }, { 10, 10 }, { -10, 10 } }, { { -5, -5 }, { -5, 5 }, { 5, 5 }, { 5, -5 } } },
+                            ExPolygon{ { { 1000000000, 0 }, { 1000000010, 0 }, { 1000000010, 10 } } } };
+        CompressedExPolygons compressed(expolys);
+        CHECK(! compressed.empty());
+        CHECK(compressed.decompress() == expolys);
+    }
+    SECTION("circles") {
+        ExPolygons expolys = make_ring_expolygons(50, 360);
+        CompressedExPolygons compressed(expolys);
+        CHECK(compressed.decompress() == expolys);
+        CHECK(compressed.memory_size() < expolys.size() * 2 * 360 * sizeof(Point));
+    }
+}
+
+TEST_CASE("CompressedExPolygons ratio and speed", "[ExPolygon][.benchmark]") {
+    auto jitter = GENERATE(coord_t(0), scale_t(0.02));
+    ExPolygons expolys  = make_ring_expolygons(2000, 720, jitter);
+    size_t     raw_size = 0;
+    for (const ExPolygon &expoly : expolys)
+        raw_size += expoly.num_contours() * 720 * sizeof(Point);
+    auto t0 = std::chrono::steady_clock::now();
+    CompressedExPolygons compressed(expolys);
+    auto t1 = std::chrono::steady_clock::now();
+    ExPolygons restored = compressed.decompress();
+    auto t2 = std::chrono::steady_clock::now();
+    std::cout << "CompressedExPolygons, jitter " << unscaled(jitter) << " mm: " << raw_size << " bytes -> " << compressed.memory_size() << " bytes, compress "
+              << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms, decompress "
+              << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms" << std::endl;
+    REQUIRE(restored == expolys);
+}
@@ -1,8 +1,10 @@
+#include <chrono>
 #include <iostream>
 #include <fstream>
 #include <catch2/catch.hpp>
 
 #include "libslic3r/SLA/Hollowing.hpp"
+#include "libslic3r/Format/OBJ.hpp"
 
 TEST_CASE("Hollow two overlapping spheres") {
     using namespace Slic3r;
@@ -19,3 +21,71 @@ TEST_CASE("Hollow two overlapping spheres") {
     sphere1.WriteOBJFile("twospheres.obj");
 }
 
+
+struct SlabHollowingFixture {
+    Slic3r::sla::HollowingConfig whole_cfg;
+    Slic3r::sla::HollowingConfig slabs_cfg;
+
+    SlabHollowingFixture() {
+        whole_cfg.max_slabs = 1;
+        slabs_cfg.max_slabs = 4;
+    }
+
+    // Test models are scaled up to be large enough to be cut into several slabs.
+    static Slic3r::TriangleMesh load_model(const char *name) {
+        Slic3r::TriangleMesh mesh;
+        REQUIRE(Slic3r::load_obj((std::string(TEST_DATA_DIR) + "/" + name).c_str(), &mesh));
+        mesh.scale(4.f);
+        return mesh;
+    }
+
+    static double interior_volume(const Slic3r::sla::InteriorPtr &interior) {
+        REQUIRE(interior);
+        return Slic3r::its_volume(Slic3r::sla::get_mesh(*interior));
+    }
+};
+
+TEST_CASE_METHOD(SlabHollowingFixture, "Hollowing in slabs matches the whole grid", "[Hollowing]") {
+    using namespace Slic3r;
+
+    indexed_triangle_set cube = its_make_cube(80., 30., 30.);
+
+    sla::InteriorPtr whole   = sla::generate_interior(cube, whole_cfg);
+    sla::InteriorPtr slabbed = sla::generate_interior(cube, slabs_cfg);
+
+    CHECK(interior_volume(slabbed) == Approx(interior_volume(whole)).epsilon(0.01));
+    REQUIRE(!sla::get_mesh(*slabbed).empty());
+    CHECK(its_split(sla::get_mesh(*slabbed)).size() == 1);
+}
+
+TEST_CASE_METHOD(SlabHollowingFixture, "Hollowing a model in slabs matches the whole grid", "[Hollowing]") {
+    using namespace Slic3r;
+
+    TriangleMesh mesh = load_model("extruder_idler.obj");
+
+    sla::InteriorPtr whole   = sla::generate_interior(mesh.its, whole_cfg);
+    sla::InteriorPtr slabbed = sla::generate_interior(mesh.its, slabs_cfg);
+
+    CHECK(interior_volume(slabbed) == Approx(interior_volume(whole)).epsilon(0.01));
+    CHECK(its_split(sla::get_mesh(*slabbed)).size() == its_split(sla::get_mesh(*whole)).size());
+}
+
+TEST_CASE_METHOD(SlabHollowingFixture, "Hollowing in slabs speed", "[Hollowing][.benchmark]") {
+    using namespace Slic3r;
+
+    for (const char *name : { "20mm_cube.obj", "extruder_idler.obj", "frog_legs.obj", "ipadstand.obj" }) {
+        TriangleMesh mesh = load_model(name);
+
+        auto timed = [&mesh](const sla::HollowingConfig &cfg) {
+            auto t0 = std::chrono::steady_clock::now();
+            sla::InteriorPtr interior = sla::generate_interior(mesh.its, cfg);
+            auto t1 = std::chrono::steady_clock::now();
+            return std::make_pair(std::chrono::duration<double, std::milli>(t1 - t0).count(), interior_volume(interior));
+        };
+
+        auto [whole_ms, whole_vol] = timed(whole_cfg);
+        auto [slabs_ms, slabs_vol] = timed(slabs_cfg);
+        std::cout << name << ": whole grid " << whole_ms << " ms, slabs " << slabs_ms << " ms" << std::endl;
+        CHECK(slabs_vol == Approx(whole_vol).epsilon(0.01));
+    }
+}
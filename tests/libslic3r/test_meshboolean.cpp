@@ -3,6 +3,7 @@
 
 #include <libslic3r/TriangleMesh.hpp>
 #include <libslic3r/MeshBoolean.hpp>
+#include <libslic3r/CSGMesh/PerformCSGMeshBooleans.hpp>
 
 using namespace Slic3r;
 
@@ -49,3 +50,61 @@ TEST_CASE("Add TriangleMeshes", "[MeshBoolean]")
     //its_write_obj(tm1.its, "test_add.obj");
     CHECK(tm1.its.indices.size() > init_size);
 }
+
+static void add_csg_cube(std::vector<csg::CSGPart> &parts, const Vec3f &size, const Vec3f &pos, csg::CSGType op)
+{
+    Transform3f trafo = Transform3f::Identity();
+    trafo.translate(pos);
+    parts.emplace_back(std::make_unique<indexed_triangle_set>(its_make_cube(size.x(), size.y(), size.z())), op, trafo);
+}
+
+// The parts applied to the result one by one, in their order, as done before the booleans were batched.
+static MeshBoolean::cgal::CGALMeshPtr perform_csg_sequentially(const std::vector<csg::CSGPart> &parts)
+{
+    MeshBoolean::cgal::CGALMeshPtr ret = MeshBoolean::cgal::triangle_mesh_to_cgal(indexed_triangle_set{});
+    for (const csg::CSGPart &part : parts) {
+        MeshBoolean::cgal::CGALMeshPtr m = csg::get_cgalmesh(part);
+        csg::detail_cgal::perform_csg(csg::get_operation(part), ret, m);
+    }
+    return ret;
+}
+
+TEST_CASE("Batched CSG booleans match the sequential ones", "[MeshBoolean]")
+{
+    std::vector<csg::CSGPart> parts;
+    // A 100 x 20 x 20 bar with holes drilled through it.
+    add_csg_cube(parts, {100.f, 20.f, 20.f}, Vec3f::Zero(), csg::CSGType::Union);
+    double expected_volume = 100. * 20. * 20.;
+
+    SECTION("Disjoint holes") {
+        for (float x : { 10.f, 30.f, 50.f, 70.f })
+            add_csg_cube(parts, {5.f, 5.f, 30.f}, {x, 7.5f, -5.f}, csg::CSGType::Difference);
+        expected_volume -= 4. * 5. * 5. * 20.;
+    }
+    SECTION("Overlapping holes") {
+        for (float x : { 10.f, 13.f })
+            add_csg_cube(parts, {5.f, 5.f, 30.f}, {x, 7.5f, -5.f}, csg::CSGType::Difference);
+        expected_volume -= 8. * 5. * 20.;
+    }
+    SECTION("Disjoint and overlapping positive parts around a hole") {
+        add_csg_cube(parts, {10.f, 10.f, 10.f}, {200.f, 0.f, 0.f}, csg::CSGType::Union);
+        add_csg_cube(parts, {10.f, 10.f, 10.f}, {205.f, 0.f, 0.f}, csg::CSGType::Union);
+        add_csg_cube(parts, {5.f, 5.f, 30.f}, {50.f, 7.5f, -5.f}, csg::CSGType::Difference);
+        expected_volume += 15. * 10. * 10. - 5. * 5. * 20.;
+    }
+
+    MeshBoolean::cgal::CGALMeshPtr batched    = csg::perform_csgmesh_booleans(range(parts));
+    MeshBoolean::cgal::CGALMeshPtr sequential = perform_csg_sequentially(parts);
+    REQUIRE(batched);
+    REQUIRE(sequential);
+
+    indexed_triangle_set batched_its    = MeshBoolean::cgal::cgal_to_indexed_triangle_set(*batched);
+    indexed_triangle_set sequential_its = MeshBoolean::cgal::cgal_to_indexed_triangle_set(*sequential);
+    CHECK(its_volume(sequential_its) == Approx(expected_volume));
+    CHECK(its_volume(batched_its) == Approx(its_volume(sequential_its)));
+
+    BoundingBoxf3 batched_bb    = MeshBoolean::cgal::bounding_box(*batched);
+    BoundingBoxf3 sequential_bb = MeshBoolean::cgal::bounding_box(*sequential);
+    CHECK((batched_bb.min - sequential_bb.min).norm() == Approx(0.).margin(EPSILON));
+    CHECK((batched_bb.max - sequential_bb.max).norm() == Approx(0.).margin(EPSILON));
+}
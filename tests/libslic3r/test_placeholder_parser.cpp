@@ -44,6 +44,14 @@ SCENARIO("Placeholder parser scripting", "[PlaceholderParser]") {
     SECTION("nested config options (legacy syntax)") { REQUIRE(parser.process("[temperature_[foo]]") == "357"); }
     SECTION("array reference") { REQUIRE(parser.process("{temperature[foo]}") == "357"); }
     SECTION("whitespaces and newlines are maintained") { REQUIRE(parser.process("test [ temperature_ [foo] ] \n hu") == "test 357 \n hu"); }
+    SECTION("plain text") { REQUIRE(parser.process("G28 ; home\nG1 Z5") == "G28 ; home\nG1 Z5"); }
+    SECTION("escaped brackets") { REQUIRE(parser.process("\\[bar\\] \\{bar") == "[bar\\] {bar"); }
+    SECTION("legacy variables") { REQUIRE(parser.process("M104 S[temperature_1] ; [bar] [gcode_flavor]") == "M104 S359 ; 2 marlin"); }
+    SECTION("legacy variables processed repeatedly") {
+        for (int i = 0; i < 3; ++ i)
+            REQUIRE(parser.process("[bar]-[temperature_3]") == "2-378");
+    }
+    SECTION("legacy variable does not exist") { REQUIRE_THROWS_AS(parser.process("M104 S[no_such_variable]"), std::runtime_error); }
     SECTION("nullable is not null") { REQUIRE(parser.process("{is_nil(filament_retract_length[0])}") == "false"); }
     SECTION("nullable is null") { REQUIRE(parser.process("{is_nil(filament_retract_length[1])}") == "true"); }
     SECTION("nullable is not null 2") { REQUIRE(parser.process("{is_nil(filament_retract_length[2])}") == "false"); }
@@ -39,6 +39,58 @@ TEST_CASE_METHOD(PolylineTestCase, "Append", "[Polyline]") {
     CHECK(tested_polyline.points == expected);
 }
 
+TEST_CASE_METHOD(PolylineTestCase, "Straight ArcPolyline", "[Polyline]") {
+    ArcPolyline arc_polyline(polyline);
+    REQUIRE(! arc_polyline.has_arc());
+    CHECK(arc_polyline.length() == Approx(polyline.length()));
+    CHECK(arc_polyline.to_polyline() == polyline);
+    arc_polyline.reverse();
+    Polyline reversed = polyline;
+    reversed.reverse();
+    CHECK(arc_polyline.to_polyline() == reversed);
+}
+
+TEST_CASE("ArcPolyline with an arc", "[Polyline]") {
+    // quarter of circle of radius 1mm (center at 1,1) between two strait segments
+    const coord_t r = scaled(1.);
+    ArcPolyline arc_polyline(Points{{0, 0}, {r, 0}});
+    arc_polyline.append(Geometry::ArcWelder::Segment{Point{2 * r, r}, float(r), Geometry::ArcWelder::Orientation::CCW});
+    arc_polyline.append(Point{2 * r, 2 * r});
+    REQUIRE(arc_polyline.has_arc());
+    REQUIRE(arc_polyline.size() == 4);
+    const double length = 2 * r + r * PI / 2;
+    CHECK(arc_polyline.length() == Approx(length));
+
+    const Geometry::ArcWelder::Path path = arc_polyline.get_arc();
+    REQUIRE(path.size() == 4);
+    CHECK(path[1].linear());
+    CHECK(path[2].radius == float(r));
+    CHECK(path[2].ccw());
+    CHECK(path[3].linear());
+    CHECK(ArcPolyline(path).get_arc() == path);
+
+    arc_polyline.reverse();
+    CHECK(arc_polyline.front() == Point(2 * r, 2 * r));
+    CHECK(arc_polyline.get_arc(2).radius == float(r));
+    CHECK(arc_polyline.get_arc(2).cw());
+    CHECK(arc_polyline.get_arc(1).linear());
+    CHECK(arc_polyline.length() == Approx(length));
+    arc_polyline.reverse();
+    CHECK(arc_polyline.get_arc() == path);
+
+    ArcPolyline p1, p2;
+    REQUIRE(arc_polyline.split_at_index(2, p1, p2));
+    CHECK(p1.size() == 3);
+    CHECK(p1.has_arc());
+    CHECK(p2.size() == 2);
+    CHECK(! p2.has_arc());
+
+    arc_polyline.clip_end(r / 2);
+    CHECK(arc_polyline.back() == Point(2 * r, r + r / 2));
+    CHECK(arc_polyline.has_arc());
+    CHECK(arc_polyline.length() == Approx(length - r / 2));
+}
+
 TEST_CASE_METHOD(PolylineTestCase, "Extend end", "[Polyline]") {
     CHECK(polyline.length() == 100*2);
     polyline.extend_end(50);
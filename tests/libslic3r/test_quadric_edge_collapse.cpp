@@ -239,6 +239,31 @@ TEST_CASE("Simplify frog_legs.obj to 5% by Quadric edge collapse", "[its][quadri
     Private::is_better_similarity(mesh.its, its, Private::frog_leg_5);
 }
 
+TEST_CASE("Simplify frog_legs.obj to 5% by partitioned Quadric edge collapse", "[its][quadric_edge_collapse]")
+{
+    TriangleMesh mesh            = load_model("frog_legs.obj");
+    REQUIRE_FALSE(mesh.empty());
+    double       original_volume = its_volume(mesh.its);
+    uint32_t     wanted_count    = mesh.its.indices.size() * 0.05;
+    // force several partitions on the small model
+    uint32_t     partition_size  = mesh.its.indices.size() / 8 + 1;
+    indexed_triangle_set its       = mesh.its; // copy
+    float                max_error = std::numeric_limits<float>::max();
+    its_quadric_edge_collapse_partitioned(its, wanted_count, &max_error, nullptr, nullptr, partition_size);
+    CHECK(its.indices.size() <= wanted_count);
+    double volume = its_volume(its);
+    CHECK(fabs(original_volume - volume) < 33.);
+    CHECK(!Private::exist_triangle_with_twice_vertices(its.indices));
+
+    Private::is_better_similarity(mesh.its, its, Private::frog_leg_5);
+
+    // result does not depend on the scheduling of partitions
+    indexed_triangle_set its2 = mesh.its; // copy
+    its_quadric_edge_collapse_partitioned(its2, wanted_count, nullptr, nullptr, nullptr, partition_size);
+    CHECK(its.vertices == its2.vertices);
+    CHECK(its.indices == its2.indices);
+}
+
 #include <libigl/igl/qslim.h>
 TEST_CASE("Simplify frog_legs.obj to 5% by IGL/qslim", "[]")
 {
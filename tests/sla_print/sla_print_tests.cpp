@@ -8,6 +8,7 @@
 #include <libslic3r/TriangleMeshSlicer.hpp>
 #include <libslic3r/SLA/SupportTreeMesher.hpp>
 #include <libslic3r/BranchingTree/PointCloud.hpp>
+#include <libslic3r/SLA/BranchingTreeSLA.hpp>
 
 namespace {
 
@@ -186,6 +187,120 @@ TEST_CASE("BranchingSupports::FloorSupportsDoNotPierceModel", "[SLASupportGenera
         test_support_model_collision(fname, supportcfg);
 }
 
+TEST_CASE("BranchingSupports::CachedQueriesGiveSameTree", "[SLASupportGeneration][Branching]") {
+
+    TriangleMesh mesh = load_model("A_upsidedown.obj");
+    REQUIRE_FALSE(mesh.empty());
+
+    sla::SupportTreeConfig supportcfg;
+    supportcfg.tree_type = sla::SupportTreeType::Branching;
+
+    sla::SupportPoints pts = calc_support_pts(mesh);
+    REQUIRE(pts.size() > 1);
+
+    auto build_tree = [](const sla::SupportableMesh &sm) {
+        sla::SupportTreeBuilder builder;
+        sla::create_branching_tree(builder, sm);
+        return builder.retrieve_mesh(sla::MeshType::Support);
+    };
+
+    sla::SupportableMesh sm{mesh.its, pts, supportcfg};
+    indexed_triangle_set fresh = build_tree(sm);
+    REQUIRE(sm.branching_tree_cache);
+    REQUIRE_FALSE(fresh.empty());
+
+    // All the mesh queries are answered by the cache now
+    indexed_triangle_set cached = build_tree(sm);
+    REQUIRE(cached.vertices == fresh.vertices);
+    REQUIRE(cached.indices == fresh.indices);
+
+    // Edited support points, only the queries of the original points are cached
+    sm.pts.resize(pts.size() / 2);
+    indexed_triangle_set edited = build_tree(sm);
+
+    sla::SupportableMesh sm_edited{mesh.its, sm.pts, supportcfg};
+    indexed_triangle_set edited_fresh = build_tree(sm_edited);
+    REQUIRE(edited.vertices == edited_fresh.vertices);
+    REQUIRE(edited.indices == edited_fresh.indices);
+}
+
+// Objects with user placed support points below their bottom: the automatic placement is randomized.
+static void add_supported_object(Model &model, TriangleMesh &&mesh, const Vec3d &offset)
+{
+    ModelObject *mo = model.add_object("", "", std::move(mesh));
+    mo->add_instance()->set_offset(offset);
+    const BoundingBoxf3 &bb = mo->raw_mesh_bounding_box();
+    for (double x : { 0.2, 0.5, 0.8 })
+        for (double y : { 0.2, 0.5, 0.8 })
+            mo->sla_support_points.emplace_back(float(bb.min.x() + x * bb.size().x()), float(bb.min.y() + y * bb.size().y()),
+                                                float(bb.min.z()), 0.4f);
+    mo->sla_points_status = sla::PointsStatus::UserModified;
+}
+
+static void process_sla_print(SLAPrint &print, const Model &model)
+{
+    SLAFullPrintConfig fullcfg;
+    fullcfg.printer_technology.value = ptSLA;
+    fullcfg.set("supports_enable", true);
+    fullcfg.set("pad_enable", true);
+    DynamicPrintConfig cfg;
+    cfg.apply(fullcfg);
+
+    print.set_status_callback([](const PrintBase::SlicingStatus&) {});
+    print.apply(model, cfg);
+    print.process();
+}
+
+static double slice_area(const SLAPrintObject &po, SliceOrigin origin)
+{
+    double area = 0.;
+    for (const SLAPrintObject::SliceRecord &rec : po.get_slice_index())
+        area += Slic3r::area(rec.get_slice(origin));
+    return area;
+}
+
+TEST_CASE("Objects processed together match the objects processed alone", "[SLAPrint]") {
+    auto make_mesh = [](size_t idx) {
+        return TriangleMesh{idx == 0 ? its_make_cube(20., 20., 20.) : its_make_cube(10., 30., 15.)};
+    };
+    const std::vector<Vec3d> offsets { { -30., 0., 0. }, { 30., 0., 0. } };
+
+    // Both objects in one print, their steps run concurrently.
+    Model model;
+    for (size_t i = 0; i < offsets.size(); ++ i)
+        add_supported_object(model, make_mesh(i), offsets[i]);
+    SLAPrint print;
+    process_sla_print(print, model);
+    REQUIRE(print.objects().size() == offsets.size());
+
+    for (size_t i = 0; i < offsets.size(); ++ i) {
+        INFO("Object " << i);
+        Model single_model;
+        add_supported_object(single_model, make_mesh(i), offsets[i]);
+        SLAPrint single_print;
+        process_sla_print(single_print, single_model);
+        REQUIRE(single_print.objects().size() == 1);
+
+        const SLAPrintObject &po     = *print.objects()[i];
+        const SLAPrintObject &single = *single_print.objects().front();
+        REQUIRE(po.is_step_done(slaposPad));
+        REQUIRE(single.is_step_done(slaposPad));
+
+        REQUIRE(!single.support_mesh().empty());
+        REQUIRE(!single.pad_mesh().empty());
+        CHECK(its_volume(po.support_mesh().its) == Approx(its_volume(single.support_mesh().its)));
+        CHECK(its_volume(po.pad_mesh().its) == Approx(its_volume(single.pad_mesh().its)));
+        CHECK(po.support_mesh().bounding_box().size().isApprox(single.support_mesh().bounding_box().size()));
+        CHECK(po.pad_mesh().bounding_box().size().isApprox(single.pad_mesh().bounding_box().size()));
+
+        REQUIRE(po.get_slice_index().size() == single.get_slice_index().size());
+        for (size_t j = 0; j < po.get_slice_index().size(); ++ j)
+            CHECK(po.get_slice_index()[j].print_level() == single.get_slice_index()[j].print_level());
+        CHECK(slice_area(po, soModel) == Approx(slice_area(single, soModel)));
+        CHECK(slice_area(po, soSupport) == Approx(slice_area(single, soSupport)));
+    }
+}
+
 TEST_CASE("InitializedRasterShouldBeNONEmpty", "[SLARasterOutput]") {
     // Default Prusa SL1 display parameters
     sla::Resolution res{2560, 1440};
@@ -139,4 +139,37 @@ TEST_CASE("Two parallel plates should be supported", "[SupGen][Hollowed]")
     REQUIRE(!pts.empty());
 }
 
+TEST_CASE("Plate of overhanging parts should be supported independently of the scheduling", "[SupGen]")
+{
+    double width = 5., depth = 5., height = 1.;
+
+    // Grid of lifted plates, each one covered by its own cluster of islands.
+    TriangleMesh mesh;
+    for (int i = 0; i < 4; ++i)
+        for (int j = 0; j < 4; ++j) {
+            TriangleMesh part = make_cube(width, depth, height);
+            part.translate(float(i * 2. * width), float(j * 2. * depth), 5.); // lift up
+            mesh.merge(part);
+        }
+
+    sla::SupportPointGenerator::Config cfg;
+    sla::SupportPoints pts = calc_support_pts(mesh, cfg);
+
+    REQUIRE(!pts.empty());
+    REQUIRE(min_point_distance(pts) >= cfg.minimal_distance);
+    for (int i = 0; i < 4; ++i)
+        for (int j = 0; j < 4; ++j) {
+            BoundingBoxf part_bb{Vec2d{i * 2. * width, j * 2. * depth}, Vec2d{i * 2. * width + width, j * 2. * depth + depth}};
+            part_bb.offset(0.5);
+            size_t part_pts = std::count_if(pts.begin(), pts.end(), [&part_bb](const sla::SupportPoint &pt) {
+                return part_bb.contains(pt.pos.head<2>().cast<double>());
+            });
+            REQUIRE(part_pts * cfg.support_force() > width * depth * cfg.tear_pressure());
+        }
+
+    // Same seed gives the same points.
+    sla::SupportPoints pts2 = calc_support_pts(mesh, cfg);
+    REQUIRE(pts == pts2);
+}
+
 }} // namespace Slic3r::sla
@@ -8,6 +8,8 @@
 #include <libslic3r/GCode.hpp>
 #include <libslic3r/Format/3mf.hpp>
 
+#include <chrono>
+
 using namespace Slic3r;
 using namespace Slic3r::Geometry;
 using namespace Slic3r::Test;
@@ -519,3 +521,58 @@ SCENARIO("thin walls: ")
     }
 
 }
+
+static ExPolygons make_thin_walls(size_t count)
+{
+    ExPolygons thin_walls;
+    for (size_t i = 0; i < count; ++i) {
+        ExPolygon expolygon;
+        double x = 2. * double(i % 50), y = 12. * double(i / 50);
+        expolygon.contour = Slic3r::Polygon{ Points{
+            Point::new_scale(x - 0.5, y),
+            Point::new_scale(x + 0.5, y),
+            Point::new_scale(x + 0.3, y + 10),
+            Point::new_scale(x - 0.3, y + 10) } };
+        thin_walls.push_back(std::move(expolygon));
+    }
+    return thin_walls;
+}
+
+static void build_thin_walls(const ExPolygons &thin_walls, ThickPolylines &polylines_out, bool parallel)
+{
+    auto build_one = [&thin_walls](size_t idx, ThickPolylines &out) {
+        MedialAxis{ thin_walls[idx], scale_t(1.1), scale_t(0.5), scale_t(0.2) }.build(out);
+    };
+    if (parallel) {
+        build_medial_axes(thin_walls.size(), build_one, polylines_out);
+    } else {
+        for (size_t idx = 0; idx < thin_walls.size(); ++idx)
+            build_one(idx, polylines_out);
+    }
+}
+
+TEST_CASE("build_medial_axes gives the same result as a serial build", "[MedialAxis]") {
+    ExPolygons thin_walls = make_thin_walls(100);
+    ThickPolylines serial, parallel;
+    build_thin_walls(thin_walls, serial, false);
+    build_thin_walls(thin_walls, parallel, true);
+    REQUIRE(serial.size() == parallel.size());
+    for (size_t idx = 0; idx < serial.size(); ++idx) {
+        REQUIRE(serial[idx].points == parallel[idx].points);
+        REQUIRE(serial[idx].points_width == parallel[idx].points_width);
+    }
+}
+
+TEST_CASE("build_medial_axes speed", "[MedialAxis][.benchmark]") {
+    ExPolygons thin_walls = make_thin_walls(2000);
+    ThickPolylines serial, parallel;
+    auto t0 = std::chrono::steady_clock::now();
+    build_thin_walls(thin_walls, serial, false);
+    auto t1 = std::chrono::steady_clock::now();
+    build_thin_walls(thin_walls, parallel, true);
+    auto t2 = std::chrono::steady_clock::now();
+    std::cout << "MedialAxis on " << thin_walls.size() << " thin walls: serial "
+              << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms, parallel "
+              << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms" << std::endl;
+    REQUIRE(serial.size() == parallel.size());
+}